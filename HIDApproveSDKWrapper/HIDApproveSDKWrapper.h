@@ -8,23 +8,42 @@
 #import <Foundation/Foundation.h>
 #import <JavaScriptCore/JavaScriptCore.h>
 @interface HIDApproveSDKWrapper : NSObject
++(void)setPrewarmOnInit : (BOOL)enabled;
+-(void)prewarm;
+-(void)cancelPrewarm;
+-(HIDApproveSDKWrapper *)sessionForUser : (NSString *)userId;
 -(void)createContainer : (NSString *)activationCode withPushId :(NSString *)PushId withPwdCallBack:(JSValue *)pwdCallback withExCallback: (JSValue *) ExceptionCallback;
 -(void)renewContainer : (NSString *)password withPwdCallBack:(JSValue *)promptCallback withExceptionCallBack: (JSValue *)ExceptionCallback;
+-(void)startRenewalScheduler : (JSValue *)renewalCallback withBackgroundRenewal: (bool)backgroundRenewal;
+-(void)stopRenewalScheduler;
 -(int)getContainerRenewableDate;
 -(void)setPasswordForUser : (NSString *)password;
 -(NSString *)getLoginFlow : (NSString *)pushId callBack: (JSValue *) genericExecutionCallback;
+-(NSString *)getLoginFlow : (NSString *)pushId callBack: (JSValue *) genericExecutionCallback withPushIdCallback: (JSValue *) pushIdCallback;
+-(void)refreshPushId : (NSString *)pushId withCallback: (JSValue *) pushIdCallback;
+-(NSString *)getLoginFlowSnapshot : (JSValue *) reconcileCallback;
 -(void)generateOTP : (NSString *)password  isBioEnabled : (bool) bioEnabled withSuccessCB : (JSValue *)success_CB failureCB : (JSValue *)failure_CB;
 -(void)enableBiometrics : (NSString *)password statusCB : (JSValue *)bioStatusCallback;
 -(void)disableBiometrics;
 -(bool)checkBioAvailability;
+-(bool)checkUserBioStatus;
+-(bool)checkOtherUsersBioStatus;
 -(void) signTransaction : (NSString *)transactionDetails withPwdPromptCallback : (JSValue *) pwdPromptCallback withSuccessCB : (JSValue *) successCB withFailureCB : (JSValue *) failureCB;
 -(NSString *) retreiveTransaction : (NSString *)txID withPassword : (NSString *)pwd
                      isBioEnabled : (bool)isBioEnabled withCallback : (JSValue*)callback;
 -(void) setNotificationStatus : (NSString *) txID withStatus : (NSString *)status withPassword :pwd withJSCallback : (JSValue *) onCompleteCB withPwdPromptCB : (JSValue *)pwdPromptCB;
+-(void) setNotificationStatuses : (NSString *)statusRequests withPassword : (NSString *)pwd withJSCallback : (JSValue *)onCompleteCB;
 -(void)transactionCancel:(NSString *)txId withMessage:(NSString *)message withReason:(NSString *)reason withCallback:(JSValue *)cancelCallback;
+-(void) prepareSignatureChallenge : (NSString *)transactionDetails withOTPLabel : (NSString *) otpLabel;
+-(void) prepareSignTransaction : (NSString *)transactionDetails withOTPLabel : (NSString *) otpLabel withCallback : (JSValue *)callback;
+-(void) commitSignTransaction : (NSString *)sessionHandle withPassword : (NSString *)password isBioEnabled : (bool)isBioEnabled withSuccessCB : (JSValue *) successCB withFailureCB : (JSValue *) failureCB;
 -(void) notifyPassword : (NSString *) password withMode : (NSString *)mode;
 -(void) updatePassword : (NSString *) oldPassword newPassword : (NSString *)newPassword exceptionCallback : (JSValue *)ExceptionCallback isPasswordPolicy : (bool) isPasswordPolicy;
 -(void) retrievePendingNotifications : (JSValue *)callback;
+-(void) retrievePendingTransactions : (JSValue *)callback;
+-(void) retrievePendingNotificationsDelta : (NSString *)syncToken withCallback : (JSValue *)callback;
+-(void) prefetchTransaction : (NSString *)txID;
+-(void) setTransactionEventCallback : (JSValue *)callback;
 -(NSString *) getPasswordPolicy ;
 -(void) setUsername: (NSString* )username;
 -(bool) deleteContainer;
@@ -33,16 +52,23 @@
 -(void) deleteContainerWithAuthWithReason : (NSString *)pwd withReason: (NSString *)reason withCallback : (JSValue *) callback;
 -(void) verifyPassword : (NSString *) pwd isBioEnabled : (bool) isBioEnabled withCallback : (JSValue *) callback;
 -(void)generateOTP : (NSString *)password  isBioEnabled : (bool) bioEnabled withSuccessCB : (JSValue *)success_CB failureCB : (JSValue *)failure_CB withOTPLabel : (NSString *) otpLabel;
+-(void)generateOTPs : (NSString *)otpLabels withPassword : (NSString *)password isBioEnabled : (bool) bioEnabled withSuccessCB : (JSValue *)success_CB failureCB : (JSValue *)failure_CB;
+-(void) setTOTPCacheEnabled : (bool) enabled;
 -(void) signTransaction : (NSString *)transactionDetails withPwdPromptCallback : (JSValue *) pwdPromptCallback withSuccessCB : (JSValue *) successCB withFailureCB : (JSValue *) failureCB  withOTPLabel : (NSString *) otpLabel;
 -(NSString *) getDeviceProperty;
 -(NSString *) getContainerFriendlyName;
 -(NSString *) getMultiContainerFriendlyName;
+-(NSString *) getContainerDirectory;
 -(void) setContainerFriendlyName : (NSString *)username withFriendlyName: (NSString *)friendlyName withSetNameCallback : (JSValue *)setNameCallback;
 -(NSString *) getLockPolicy:(NSString *)otp_Key withCode: (NSString *)code;
 -(NSString *)getInfo;
+-(NSString *)getInfoDelta : (NSString *)sinceToken;
 -(NSString *)getKeyList;
+-(NSString *)getOTPAlgorithmParameters;
 -(void) directClientSignature : (NSString *)txMessage withKeyMode:(NSString *)keyMode withGenerateCallback:(JSValue *)generateCallback;
 -(void)directClientSignatureWithStatus: (NSString *)consensus withPassword:(NSString *)password withBiometricEnabled:(BOOL)isBiometricEnabled withDCSCallback:(JSValue *)dcsCallback;
+-(void)directClientSignatureWithStatus: (NSString *)consensus withRequestId:(NSString *)requestId withPassword:(NSString *)password withBiometricEnabled:(BOOL)isBiometricEnabled withDCSCallback:(JSValue *)dcsCallback;
+-(void)directClientSignatureWithConsensus: (NSString *)txMessage withKeyMode:(NSString *)keyMode withConsensus:(NSString *)consensus withPassword:(NSString *)password withBiometricEnabled:(BOOL)isBiometricEnabled withPayloadCallback:(JSValue *)payloadCallback withDCSCallback:(JSValue *)dcsCallback;
 @end
 
 
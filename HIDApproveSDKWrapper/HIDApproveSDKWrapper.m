@@ -7,6 +7,8 @@
 #import "HIDApproveSDKWrapper.h"
 #import <Foundation/Foundation.h>
 #import <JavaScriptCore/JavaScriptCore.h>
+#import <UIKit/UIKit.h>
+#import <CommonCrypto/CommonDigest.h>
 #import <HID_Approve_SDK/HIDContainer.h>
 #import <HID_Approve_SDK/HIDProtectionPolicy.h>
 #import <HID_Approve_SDK/HIDDevice.h>
@@ -25,6 +27,7 @@
 @property (nonatomic , strong) NSString* monitorObj;
 @property (strong) JSValue *pwdCallback;
 @property (strong) JSValue *exceptionCallback;
+@property (assign) bool cancelsPasswordPrompt;
 @end
 
 @implementation ContainerEventListener
@@ -54,6 +57,10 @@
     NSLog(@"ApproveSDKWrapper ---> HID:HIDEventResult_onEventReceived Event Triggered");
     if ([event isKindOfClass:[HIDPasswordPromptEvent class]]) {
         NSLog(@"ApproveSDKWrapper ---> HID:HIDEventResult_onEventReceived Password Event Triggered");
+        if (self.cancelsPasswordPrompt) {
+            //Nobody can answer the prompt during a background operation
+            return [[HIDEventResult alloc] initWithCode:(Cancel)];
+        }
         HIDPasswordPromptEvent* pwdEvent = (HIDPasswordPromptEvent*)event;
         id<HIDPasswordPolicy> pwdPolicy = [pwdEvent passwordPolicy];
         NSDictionary *obj = [NSDictionary dictionaryWithObjectsAndKeys:
@@ -110,60 +117,690 @@
 
 //Transaction Event Listener
 
+@interface PendingDCSTransaction : NSObject
+@property (nonatomic, strong, readonly) NSString *requestId;
+@property (nonatomic, strong, readonly) id<HIDTransaction> transaction;
+@property (nonatomic, strong, readonly) NSDate *deadline;
+- (instancetype)initWithRequestId:(NSString *)requestId
+                      transaction:(id<HIDTransaction>)transaction
+                          timeout:(NSTimeInterval)timeout;
+@end
+@implementation PendingDCSTransaction
+- (instancetype)initWithRequestId:(NSString *)requestId
+                      transaction:(id<HIDTransaction>)transaction
+                          timeout:(NSTimeInterval)timeout {
+    self = [super init];
+    if (self) {
+        _requestId = requestId;
+        _transaction = transaction;
+        _deadline = [NSDate dateWithTimeIntervalSinceNow:timeout];
+    }
+    return self;
+}
+@end
+
 @interface TransactionMonitor : NSObject
-@property (nonatomic, strong) id<HIDTransaction> transaction;
-@property (nonatomic, strong) NSString *consensus;
-@property (nonatomic, strong) NSString *password;
-@property (nonatomic, assign) BOOL isBiometricEnabled;
-- (void)setTransaction:(id<HIDTransaction>)transaction;
-- (id<HIDTransaction>)getTransaction;
-- (void)setUserInputWithConsensus:(NSString *)consensus
-                         password:(NSString *)password
-              biometricEnabled:(BOOL)isBiometricEnabled;
-- (void)waitForUserInput;
-- (void)clear;
+- (NSString *)addTransaction:(id<HIDTransaction>)transaction timeout:(NSTimeInterval)timeout;
+- (PendingDCSTransaction *)pendingTransactionForRequestId:(NSString *)requestId;
+- (void)removeRequestId:(NSString *)requestId;
 @end
 @implementation TransactionMonitor {
-    NSCondition *_condition;
+    NSMutableDictionary<NSString *, PendingDCSTransaction *> *_pending;
+    NSString *_latestRequestId;
 }
 - (instancetype)init {
     self = [super init];
     if (self) {
-        _condition = [[NSCondition alloc] init];
+        _pending = [NSMutableDictionary dictionary];
     }
     return self;
 }
-- (void)setTransaction:(id<HIDTransaction>)transaction {
+- (NSString *)addTransaction:(id<HIDTransaction>)transaction timeout:(NSTimeInterval)timeout {
+    NSString *requestId = [[NSUUID UUID] UUIDString];
+    PendingDCSTransaction *pendingTransaction = [[PendingDCSTransaction alloc] initWithRequestId:requestId
+                                                                                     transaction:transaction
+                                                                                         timeout:timeout];
     @synchronized (self) {
-        _transaction = transaction;
+        [self removeExpired];
+        _pending[requestId] = pendingTransaction;
+        _latestRequestId = requestId;
+    }
+    return requestId;
+}
+// A nil requestId resolves to the most recently generated transaction
+- (PendingDCSTransaction *)pendingTransactionForRequestId:(NSString *)requestId {
+    @synchronized (self) {
+        [self removeExpired];
+        return _pending[requestId != nil ? requestId : (_latestRequestId != nil ? _latestRequestId : @"")];
+    }
+}
+- (void)removeRequestId:(NSString *)requestId {
+    if (requestId == nil) {
+        return;
+    }
+    @synchronized (self) {
+        [_pending removeObjectForKey:requestId];
+        if ([_latestRequestId isEqualToString:requestId]) {
+            _latestRequestId = nil;
+        }
+    }
+}
+- (void)removeExpired {
+    NSDate *now = [NSDate date];
+    for (NSString *requestId in [_pending allKeys]) {
+        if ([_pending[requestId].deadline compare:now] != NSOrderedDescending) {
+            [_pending removeObjectForKey:requestId];
+            if ([_latestRequestId isEqualToString:requestId]) {
+                _latestRequestId = nil;
+            }
+        }
+    }
+}
+@end
+
+//Transaction Details Tokenizer
+
+@interface TransactionDetailsTokenizer : NSObject
++ (NSArray<NSString *> *)fieldsFromString:(NSString *)details separator:(unichar)separator;
+@end
+
+@implementation TransactionDetailsTokenizer
+
+/**
+* This method splits the string on the separator in a single pass over its UTF-16 storage, without the intermediate
+* component arrays of componentsSeparatedByString. Each field is still returned as its own substring.
+* It returns the same fields as componentsSeparatedByString, including empty ones.
+*
+* @param details - The string to tokenize.
+* @param separator - The separator character, e.g. '~' for the sign transaction details.
+*
+* @return NSArray - The fields in order, nil if details is nil.
+*/
++ (NSArray<NSString *> *)fieldsFromString:(NSString *)details separator:(unichar)separator {
+    if (details == nil) {
+        return nil;
+    }
+    NSUInteger length = [details length];
+    NSMutableArray<NSString *> *fields = [NSMutableArray array];
+    const UniChar *chars = CFStringGetCharactersPtr((__bridge CFStringRef)details);
+    unichar *buffer = NULL;
+    if (chars == NULL && length > 0) {
+        buffer = malloc(length * sizeof(unichar));
+        if (buffer == NULL) {
+            return [details componentsSeparatedByString:[NSString stringWithCharacters:&separator length:1]];
+        }
+        [details getCharacters:buffer range:NSMakeRange(0, length)];
+        chars = buffer;
+    }
+    NSUInteger start = 0;
+    for (NSUInteger i = 0; i < length; i++) {
+        if (chars[i] == separator) {
+            [fields addObject:[details substringWithRange:NSMakeRange(start, i - start)]];
+            start = i + 1;
+        }
+    }
+    [fields addObject:[details substringWithRange:NSMakeRange(start, length - start)]];
+    free(buffer);
+    return fields;
+}
+@end
+
+//Bounded LRU Cache with per-entry expiry
+
+@interface ExpiringLRUCache : NSObject
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+- (void)ensureCapacity:(NSUInteger)capacity;
+- (id)objectForKey:(NSString *)key;
+- (void)setObject:(id)object forKey:(NSString *)key expiryDate:(NSDate *)expiryDate;
+- (void)removeObjectForKey:(NSString *)key;
+- (void)removeAllObjects;
+@end
+@implementation ExpiringLRUCache {
+    NSUInteger _capacity;
+    NSMutableDictionary<NSString *, id> *_objects;
+    NSMutableDictionary<NSString *, NSDate *> *_expiryDates;
+    NSMutableOrderedSet<NSString *> *_recentKeys; // least recently used first
+}
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    self = [super init];
+    if (self) {
+        _capacity = capacity > 0 ? capacity : 1;
+        _objects = [NSMutableDictionary dictionary];
+        _expiryDates = [NSMutableDictionary dictionary];
+        _recentKeys = [NSMutableOrderedSet orderedSet];
+    }
+    return self;
+}
+- (void)ensureCapacity:(NSUInteger)capacity {
+    @synchronized (self) {
+        _capacity = MAX(_capacity, capacity);
     }
 }
-- (id<HIDTransaction>)getTransaction {
+- (id)objectForKey:(NSString *)key {
+    if (key == nil) {
+        return nil;
+    }
     @synchronized (self) {
-        return _transaction;
+        id object = _objects[key];
+        if (object == nil) {
+            return nil;
+        }
+        if ([_expiryDates[key] timeIntervalSinceNow] <= 0) {
+            [self removeObjectForKey:key];
+            return nil;
+        }
+        [_recentKeys removeObject:key];
+        [_recentKeys addObject:key];
+        return object;
+    }
+}
+- (void)setObject:(id)object forKey:(NSString *)key expiryDate:(NSDate *)expiryDate {
+    if (key == nil || object == nil || expiryDate == nil) {
+        return;
+    }
+    @synchronized (self) {
+        _objects[key] = object;
+        _expiryDates[key] = expiryDate;
+        [_recentKeys removeObject:key];
+        [_recentKeys addObject:key];
+        while ([_recentKeys count] > _capacity) {
+            NSString *oldestKey = [_recentKeys firstObject];
+            [self removeObjectForKey:oldestKey];
+        }
+    }
+}
+- (void)removeObjectForKey:(NSString *)key {
+    if (key == nil) {
+        return;
+    }
+    @synchronized (self) {
+        [_objects removeObjectForKey:key];
+        [_expiryDates removeObjectForKey:key];
+        [_recentKeys removeObject:key];
+    }
+}
+- (void)removeAllObjects {
+    @synchronized (self) {
+        [_objects removeAllObjects];
+        [_expiryDates removeAllObjects];
+        [_recentKeys removeAllObjects];
+    }
+}
+@end
+
+//Retrieved Transaction
+
+@interface TransactionCacheEntry : NSObject
+@property (nonatomic, strong) id<HIDServerActionInfo> actionInfo;
+@property (nonatomic, strong) id<HIDTransaction> transaction;
+@property (nonatomic, strong) id<HIDContainer> container;
+@property (nonatomic, strong) NSDate *expiryDate;
+@property (nonatomic, strong) NSString *transactionString;
+// Warmed by prefetchTransaction, nil until then
+@property (strong) id<HIDProtectionPolicy> protectionPolicy;
+@end
+@implementation TransactionCacheEntry
+@end
+
+//Hierarchical timer wheel firing a handler when a key's expiry date is reached
+
+static const uint64_t EXPIRY_WHEEL_SLOTS = 60;
+
+@interface ExpiryTimerWheel : NSObject
+- (instancetype)initWithExpiryHandler:(void (^)(NSString *key))expiryHandler;
+- (void)scheduleKey:(NSString *)key expiryDate:(NSDate *)expiryDate;
+- (void)cancelKey:(NSString *)key;
+@end
+@implementation ExpiryTimerWheel {
+    dispatch_queue_t _queue;
+    dispatch_source_t _timer;
+    void (^_expiryHandler)(NSString *key);
+    NSDate *_startDate;
+    uint64_t _currentTick; // seconds elapsed since _startDate
+    NSMutableArray<NSMutableSet<NSString *> *> *_secondSlots; // deadlines within the next minute
+    NSMutableArray<NSMutableSet<NSString *> *> *_minuteSlots; // deadlines within the next hour
+    NSMutableSet<NSString *> *_overflow;                     // deadlines beyond the next hour
+    NSMutableDictionary<NSString *, NSNumber *> *_deadlines;
+}
+- (instancetype)initWithExpiryHandler:(void (^)(NSString *key))expiryHandler {
+    self = [super init];
+    if (self) {
+        _queue = dispatch_queue_create("com.hid.approvesdkwrapper.expirywheel", DISPATCH_QUEUE_SERIAL);
+        _expiryHandler = [expiryHandler copy];
+        _startDate = [NSDate date];
+        _currentTick = 0;
+        _secondSlots = [NSMutableArray arrayWithCapacity:EXPIRY_WHEEL_SLOTS];
+        _minuteSlots = [NSMutableArray arrayWithCapacity:EXPIRY_WHEEL_SLOTS];
+        for (uint64_t i = 0; i < EXPIRY_WHEEL_SLOTS; i++) {
+            [_secondSlots addObject:[NSMutableSet set]];
+            [_minuteSlots addObject:[NSMutableSet set]];
+        }
+        _overflow = [NSMutableSet set];
+        _deadlines = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+- (void)dealloc {
+    if (_timer != nil) {
+        dispatch_source_cancel(_timer);
+    }
+}
+- (void)scheduleKey:(NSString *)key expiryDate:(NSDate *)expiryDate {
+    if (key == nil || expiryDate == nil) {
+        return;
+    }
+    dispatch_async(_queue, ^{
+        [self advanceToNow];
+        NSTimeInterval offset = ceil([expiryDate timeIntervalSinceDate:self->_startDate]);
+        uint64_t deadline = offset > 0 ? (uint64_t)offset : 0;
+        if (deadline <= self->_currentTick) {
+            [self->_deadlines removeObjectForKey:key];
+            self->_expiryHandler(key);
+            return;
+        }
+        self->_deadlines[key] = @(deadline);
+        [self placeKey:key deadline:deadline];
+        [self startTimerIfNeeded];
+    });
+}
+- (void)cancelKey:(NSString *)key {
+    if (key == nil) {
+        return;
     }
+    dispatch_async(_queue, ^{
+        // Stale slot entries are dropped when their slot is reached
+        [self->_deadlines removeObjectForKey:key];
+        [self stopTimerIfIdle];
+    });
 }
-- (void)setUserInputWithConsensus:(NSString *)consensus
-                         password:(NSString *)password
-              biometricEnabled:(BOOL)isBiometricEnabled {
-    [_condition lock];
-    _consensus = consensus;
-    _password = password;
-    _isBiometricEnabled = isBiometricEnabled;
-    [_condition signal]; // Notify waiting thread
-    [_condition unlock];
+- (void)placeKey:(NSString *)key deadline:(uint64_t)deadline {
+    uint64_t delta = deadline - _currentTick;
+    if (delta < EXPIRY_WHEEL_SLOTS) {
+        [_secondSlots[deadline % EXPIRY_WHEEL_SLOTS] addObject:key];
+    } else if (delta < EXPIRY_WHEEL_SLOTS * EXPIRY_WHEEL_SLOTS) {
+        [_minuteSlots[(deadline / EXPIRY_WHEEL_SLOTS) % EXPIRY_WHEEL_SLOTS] addObject:key];
+    } else {
+        [_overflow addObject:key];
+    }
+}
+- (void)replaceKeys:(NSSet<NSString *> *)keys {
+    for (NSString *key in keys) {
+        NSNumber *deadline = _deadlines[key];
+        if (deadline == nil) {
+            continue;
+        }
+        if ([deadline unsignedLongLongValue] <= _currentTick) {
+            [_deadlines removeObjectForKey:key];
+            _expiryHandler(key);
+        } else {
+            [self placeKey:key deadline:[deadline unsignedLongLongValue]];
+        }
+    }
+}
+- (void)tick {
+    _currentTick += 1;
+    if (_currentTick % (EXPIRY_WHEEL_SLOTS * EXPIRY_WHEEL_SLOTS) == 0) {
+        NSSet *overflowKeys = [_overflow copy];
+        [_overflow removeAllObjects];
+        [self replaceKeys:overflowKeys];
+    }
+    if (_currentTick % EXPIRY_WHEEL_SLOTS == 0) {
+        NSMutableSet *minuteSlot = _minuteSlots[(_currentTick / EXPIRY_WHEEL_SLOTS) % EXPIRY_WHEEL_SLOTS];
+        NSSet *minuteKeys = [minuteSlot copy];
+        [minuteSlot removeAllObjects];
+        [self replaceKeys:minuteKeys];
+    }
+    NSMutableSet *secondSlot = _secondSlots[_currentTick % EXPIRY_WHEEL_SLOTS];
+    NSSet *dueKeys = [secondSlot copy];
+    [secondSlot removeAllObjects];
+    [self replaceKeys:dueKeys];
+}
+- (void)advanceToNow {
+    NSTimeInterval elapsed = [[NSDate date] timeIntervalSinceDate:_startDate];
+    uint64_t targetTick = elapsed > 0 ? (uint64_t)elapsed : 0;
+    if (targetTick <= _currentTick) {
+        return;
+    }
+    if (targetTick - _currentTick > EXPIRY_WHEEL_SLOTS * EXPIRY_WHEEL_SLOTS) {
+        // Suspended for longer than the wheel spans, re-place everything in one pass
+        _currentTick = targetTick;
+        for (NSMutableSet *slot in _secondSlots) {
+            [slot removeAllObjects];
+        }
+        for (NSMutableSet *slot in _minuteSlots) {
+            [slot removeAllObjects];
+        }
+        [_overflow removeAllObjects];
+        [self replaceKeys:[NSSet setWithArray:[_deadlines allKeys]]];
+        return;
+    }
+    while (_currentTick < targetTick) {
+        [self tick];
+    }
+}
+- (void)startTimerIfNeeded {
+    if (_timer != nil) {
+        return;
+    }
+    _timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, _queue);
+    dispatch_source_set_timer(_timer, dispatch_time(DISPATCH_TIME_NOW, NSEC_PER_SEC), NSEC_PER_SEC, NSEC_PER_SEC / 10);
+    __weak ExpiryTimerWheel *weakSelf = self;
+    dispatch_source_set_event_handler(_timer, ^{
+        ExpiryTimerWheel *strongSelf = weakSelf;
+        [strongSelf advanceToNow];
+        [strongSelf stopTimerIfIdle];
+    });
+    dispatch_resume(_timer);
+}
+- (void)stopTimerIfIdle {
+    if (_timer == nil || [_deadlines count] > 0) {
+        return;
+    }
+    dispatch_source_cancel(_timer);
+    _timer = nil;
+}
+@end
+
+//Current TOTP code, held until the end of its time step
+
+@interface TOTPCodeCache : NSObject
+- (NSString *)codeForKey:(NSString *)cacheKey validUntil:(uint64_t *)validUntil;
+- (void)storeCode:(NSString *)code forKey:(NSString *)cacheKey validUntil:(uint64_t)validUntil;
+- (void)invalidate;
+@end
+@implementation TOTPCodeCache {
+    NSString *_code;
+    NSString *_cacheKey;
+    uint64_t _validUntil;      // Unix time (seconds) at which the time step ends
+}
+- (NSString *)codeForKey:(NSString *)cacheKey validUntil:(uint64_t *)validUntil {
+    @synchronized (self) {
+        if (_code == nil || ![_cacheKey isEqualToString:cacheKey]) {
+            return nil;
+        }
+        uint64_t now = (uint64_t)[[NSDate date] timeIntervalSince1970];
+        if (now >= _validUntil) {
+            [self invalidate];
+            return nil;
+        }
+        if (validUntil != NULL) {
+            *validUntil = _validUntil;
+        }
+        return _code;
+    }
 }
-- (void)waitForUserInput {
-    [_condition lock];
-    [_condition wait]; // Wait until user input is set
-    [_condition unlock];
+- (void)storeCode:(NSString *)code forKey:(NSString *)cacheKey validUntil:(uint64_t)validUntil {
+    if (code == nil || cacheKey == nil) {
+        return;
+    }
+    @synchronized (self) {
+        _code = [code copy];
+        _cacheKey = cacheKey;
+        _validUntil = validUntil;
+    }
 }
-- (void)clear {
+- (void)invalidate {
     @synchronized (self) {
-        _transaction = nil;
-        _consensus = nil;
-        _password = nil;
-        _isBiometricEnabled = NO;
+        _code = nil;
+        _cacheKey = nil;
+        _validUntil = 0;
+    }
+}
+@end
+
+//Signing state resolved before the user approves
+
+@interface SigningSession : NSObject
+@property (nonatomic, strong) id<HIDAsyncOTPGenerator> generator;
+@property (nonatomic, strong) NSString *challenge;
+@end
+@implementation SigningSession
+@end
+
+//Pending Transaction IDs last reported to a client
+
+@interface PendingTransactionSyncState : NSObject
+@property (nonatomic, strong) NSSet<NSString *> *txIDs;
+@property (nonatomic, assign) unsigned long long syncToken;
+@end
+@implementation PendingTransactionSyncState
+@end
+
+//Container lifetime in whole milliseconds, with the renewal threshold resolved once
+
+@interface RenewalSchedule : NSObject
+@property (nonatomic, readonly) int64_t creationMillis;
+@property (nonatomic, readonly) int64_t expiryMillis;
+@property (nonatomic, readonly) NSDate *renewalDate;
+@property (nonatomic, readonly) int totalDays;
+@property (nonatomic, readonly) int thresholdDays;
+- (instancetype)initWithCreationDate:(NSDate *)creationDate expiryDate:(NSDate *)expiryDate renewalDate:(NSDate *)renewalDate;
++ (int64_t)currentMillis;
++ (NSInteger)daysFrom:(NSDate *)startDate to:(NSDate *)endDate;
+- (int)daysToExpiryAt:(int64_t)nowMillis;
+- (int)finalDaysAt:(int64_t)nowMillis;
+@end
+@implementation RenewalSchedule
+- (instancetype)initWithCreationDate:(NSDate *)creationDate expiryDate:(NSDate *)expiryDate renewalDate:(NSDate *)renewalDate {
+    self = [super init];
+    if (self) {
+        _creationMillis = (int64_t)([creationDate timeIntervalSince1970] * 1000);
+        _expiryMillis = (int64_t)([expiryDate timeIntervalSince1970] * 1000);
+        _renewalDate = renewalDate;
+        _totalDays = (int)(llabs((int64_t)[expiryDate timeIntervalSince1970] - (int64_t)[creationDate timeIntervalSince1970]) / 86400);
+        // Renewable once 2 or fewer days are left, or fewer than 20% of the total (5 * end < total)
+        _thresholdDays = MAX(2, (_totalDays - 1) / 5);
+    }
+    return self;
+}
++ (int64_t)currentMillis {
+    return (int64_t)([[NSDate date] timeIntervalSince1970] * 1000);
+}
++ (NSInteger)daysFrom:(NSDate *)startDate to:(NSDate *)endDate {
+    return (NSInteger)(((int64_t)[endDate timeIntervalSince1970] - (int64_t)[startDate timeIntervalSince1970]) / 86400);
+}
+- (int)daysToExpiryAt:(int64_t)nowMillis {
+    return (int)(llabs(_expiryMillis - nowMillis) / 86400000);
+}
+- (int)finalDaysAt:(int64_t)nowMillis {
+    int end = [self daysToExpiryAt:nowMillis];
+    return end <= _thresholdDays ? end : -end;
+}
+@end
+
+//Containers of the device indexed by normalized userId, read once per container generation
+
+@interface ContainerDirectoryEntry : NSObject
+@property (nonatomic, strong) id<HIDContainer> container;
+@property (nonatomic, copy) NSString *userId;
+@property (nonatomic, copy) NSString *friendlyName;
+@end
+@implementation ContainerDirectoryEntry
+@end
+
+@interface ContainerDirectory : NSObject
+@property (nonatomic, readonly) NSUInteger generation;
+@property (nonatomic, readonly) NSArray<ContainerDirectoryEntry *> *entries; // in SDK order
++ (NSString *)normalizedUserId:(NSString *)userId;
+- (instancetype)initWithContainers:(NSArray *)containers generation:(NSUInteger)generation;
+- (NSArray<ContainerDirectoryEntry *> *)entriesForUserId:(NSString *)userId;
+- (NSArray<ContainerDirectoryEntry *> *)sortedEntries;
+- (NSArray<ContainerDirectoryEntry *> *)entriesWithFriendlyNames;
+@end
+@implementation ContainerDirectory {
+    NSDictionary<NSString *, NSArray<ContainerDirectoryEntry *> *> *_entriesByUserId;
+    NSArray<ContainerDirectoryEntry *> *_sortedEntries;
+    bool _hasFriendlyNames;
+}
++ (NSString *)normalizedUserId:(NSString *)userId {
+    return [userId stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+}
+- (instancetype)initWithContainers:(NSArray *)containers generation:(NSUInteger)generation {
+    self = [super init];
+    if (self) {
+        _generation = generation;
+        NSMutableArray *entries = [NSMutableArray arrayWithCapacity:[containers count]];
+        NSMutableDictionary *entriesByUserId = [NSMutableDictionary dictionaryWithCapacity:[containers count]];
+        for (id<HIDContainer> container in containers) {
+            ContainerDirectoryEntry *entry = [[ContainerDirectoryEntry alloc] init];
+            entry.container = container;
+            entry.userId = [container getUserId];
+            [entries addObject:entry];
+            NSString *normalizedUserId = [ContainerDirectory normalizedUserId:entry.userId];
+            if (normalizedUserId == nil) {
+                continue;
+            }
+            NSArray *userEntries = entriesByUserId[normalizedUserId];
+            entriesByUserId[normalizedUserId] = userEntries != nil ? [userEntries arrayByAddingObject:entry] : @[entry];
+        }
+        _entries = entries;
+        _entriesByUserId = entriesByUserId;
+    }
+    return self;
+}
+- (NSArray<ContainerDirectoryEntry *> *)entriesForUserId:(NSString *)userId {
+    NSString *normalizedUserId = [ContainerDirectory normalizedUserId:userId];
+    return normalizedUserId != nil ? _entriesByUserId[normalizedUserId] : nil;
+}
+- (NSArray<ContainerDirectoryEntry *> *)sortedEntries {
+    @synchronized (self) {
+        if (_sortedEntries == nil) {
+            _sortedEntries = [_entries sortedArrayUsingComparator:^NSComparisonResult(ContainerDirectoryEntry *a, ContainerDirectoryEntry *b) {
+                return [[ContainerDirectory normalizedUserId:a.userId] compare:[ContainerDirectory normalizedUserId:b.userId]];
+            }];
+        }
+        return _sortedEntries;
+    }
+}
+- (NSArray<ContainerDirectoryEntry *> *)entriesWithFriendlyNames {
+    @synchronized (self) {
+        if (!_hasFriendlyNames) {
+            for (ContainerDirectoryEntry *entry in _entries) {
+                entry.friendlyName = [entry.container getName];
+            }
+            _hasFriendlyNames = true;
+        }
+        return _entries;
+    }
+}
+@end
+
+//Biometric state of every container, with the users having biometrics enabled counted for O(1) queries
+
+static NSInteger const BIO_STATE_NOT_SUPPORTED = -1; // container policy is not a bio password policy
+
+@interface BioStateTable : NSObject
+@property (nonatomic, readonly) NSUInteger generation;
+@property (nonatomic, readonly) bool hasPolicyError;
+@property (atomic, assign) NSUInteger stateGeneration; // biometric state generation the table reflects
+- (instancetype)initWithEntries:(NSArray<ContainerDirectoryEntry *> *)entries generation:(NSUInteger)generation;
+- (NSNumber *)stateForContainer:(id<HIDContainer>)container;
+- (void)setState:(NSInteger)state forContainer:(id<HIDContainer>)container;
+- (bool)isBioEnabledForUserId:(NSString *)userId;
+- (bool)isBioEnabledForOtherThanUserId:(NSString *)userId;
+- (bool)isAnyBioEnabled;
+@end
+@implementation BioStateTable {
+    NSMutableDictionary<NSNumber *, NSNumber *> *_statesByContainerId;
+    NSMutableDictionary<NSNumber *, NSString *> *_userIdsByContainerId;
+    NSCountedSet<NSString *> *_enabledUserIds; // one count per enabled container of the user
+}
+- (instancetype)initWithEntries:(NSArray<ContainerDirectoryEntry *> *)entries generation:(NSUInteger)generation {
+    self = [super init];
+    if (self) {
+        _generation = generation;
+        _statesByContainerId = [NSMutableDictionary dictionaryWithCapacity:[entries count]];
+        _userIdsByContainerId = [NSMutableDictionary dictionaryWithCapacity:[entries count]];
+        _enabledUserIds = [[NSCountedSet alloc] init];
+        for (ContainerDirectoryEntry *entry in entries) {
+            NSError *policyError = nil;
+            id<HIDProtectionPolicy> policy = [entry.container getProtectionPolicy:&policyError];
+            _hasPolicyError = _hasPolicyError || policyError != nil;
+            NSInteger state = BIO_STATE_NOT_SUPPORTED;
+            if ([policy policyType] == HIDPolicyTypeBioPassword) {
+                state = [(id<HIDBioPasswordPolicy>)policy getBioAuthenticationState];
+            }
+            [self setState:state forContainer:entry.container];
+        }
+    }
+    return self;
+}
+- (NSNumber *)stateForContainer:(id<HIDContainer>)container {
+    @synchronized (self) {
+        return container != nil ? _statesByContainerId[@([container getId])] : nil;
+    }
+}
+- (void)setState:(NSInteger)state forContainer:(id<HIDContainer>)container {
+    if (container == nil) {
+        return;
+    }
+    NSNumber *containerId = @([container getId]);
+    @synchronized (self) {
+        NSString *userId = _userIdsByContainerId[containerId];
+        if (userId == nil) {
+            userId = [ContainerDirectory normalizedUserId:[container getUserId]];
+            if (userId == nil) {
+                userId = @"";
+            }
+            _userIdsByContainerId[containerId] = userId;
+        }
+        NSNumber *previousState = _statesByContainerId[containerId];
+        if (previousState != nil && [previousState integerValue] == HIDBioAuthenticationStateEnabled) {
+            [_enabledUserIds removeObject:userId];
+        }
+        _statesByContainerId[containerId] = @(state);
+        if (state == HIDBioAuthenticationStateEnabled) {
+            [_enabledUserIds addObject:userId];
+        }
+    }
+}
+- (bool)isBioEnabledForUserId:(NSString *)userId {
+    NSString *normalizedUserId = [ContainerDirectory normalizedUserId:userId];
+    @synchronized (self) {
+        return normalizedUserId != nil && [_enabledUserIds countForObject:normalizedUserId] > 0;
+    }
+}
+- (bool)isBioEnabledForOtherThanUserId:(NSString *)userId {
+    NSString *normalizedUserId = [ContainerDirectory normalizedUserId:userId];
+    @synchronized (self) {
+        NSUInteger ownUsers = normalizedUserId != nil && [_enabledUserIds countForObject:normalizedUserId] > 0 ? 1 : 0;
+        return [_enabledUserIds count] > ownUsers;
+    }
+}
+- (bool)isAnyBioEnabled {
+    @synchronized (self) {
+        return [_enabledUserIds count] > 0;
+    }
+}
+@end
+
+//Container and protection policy resolved for one user, valid for one container generation
+
+@interface UserSession : NSObject
+@property (nonatomic, readonly) NSString *userId;
+@property (nonatomic, readonly) NSUInteger generation;
+@property (nonatomic, readonly) id<HIDContainer> container;
+- (instancetype)initWithUserId:(NSString *)userId container:(id<HIDContainer>)container generation:(NSUInteger)generation;
+- (id<HIDProtectionPolicy>)protectionPolicy:(NSError **)error;
+@end
+@implementation UserSession {
+    id<HIDProtectionPolicy> _protectionPolicy;
+}
+- (instancetype)initWithUserId:(NSString *)userId container:(id<HIDContainer>)container generation:(NSUInteger)generation {
+    self = [super init];
+    if (self) {
+        _userId = [userId copy];
+        _container = container;
+        _generation = generation;
+    }
+    return self;
+}
+- (id<HIDProtectionPolicy>)protectionPolicy:(NSError **)error {
+    @synchronized (self) {
+        if (_protectionPolicy == nil) {
+            _protectionPolicy = [_container getProtectionPolicy:error];
+        }
+        return _protectionPolicy;
     }
 }
 @end
@@ -175,10 +812,389 @@
 @property (nonatomic, strong) TransactionMonitor *transactionMonitor;
 @property (strong) dispatch_group_t tsGroup;
 @property (strong, nonatomic) NSString* username;
+@property (nonatomic, strong) ExpiringLRUCache *transactionCache;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, dispatch_group_t> *transactionFetches;
+@property (nonatomic, strong) NSMutableDictionary<NSNumber *, PendingTransactionSyncState *> *pendingSyncStates;
+@property (nonatomic, assign) unsigned long long lastSyncToken;
+@property (nonatomic, strong) ExpiryTimerWheel *expiryWheel;
+@property (nonatomic, strong) ExpiringLRUCache *expiredTransactions;
+@property (nonatomic, strong) JSValue *transactionEventCallback;
+@property (nonatomic, strong) TOTPCodeCache *totpCodeCache;
+@property (assign) bool isTOTPCacheEnabled;
+@property (nonatomic, strong) ExpiringLRUCache *signatureChallengeCache;
+@property (nonatomic, strong) ExpiringLRUCache *signingSessions;
+@property (atomic, assign) NSUInteger seenContainerGeneration;
+@property (strong) UserSession *session;
+@property (strong) BioStateTable *bioStates;
+@property (nonatomic, strong) id foregroundObserver;
+@property (nonatomic, assign) bool isUserBound;
+@property (nonatomic, weak) HIDApproveSDKWrapper *parentWrapper;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, HIDApproveSDKWrapper *> *userSessions;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, id<HIDKey>> *dcsKeyHandles;
+@property (atomic, copy) NSString *lastPushId;
+@property (nonatomic, strong) dispatch_queue_t snapshotQueue;
+@property (atomic, copy) NSDictionary *loginFlowSnapshot;
+@property (strong) id<HIDDevice> device;
+@property (strong) dispatch_group_t prewarmGroup;
+@property (assign) bool isPrewarmCancelled;
+@property (assign) bool isPrewarmFinished;
+@property (atomic, copy) NSDictionary *staticDeviceInfo;
+@property (nonatomic, strong) NSDictionary<NSString *, NSDictionary *> *containerInfoCache;
+@property (nonatomic, assign) NSUInteger containerInfoGeneration;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSArray *> *infoFields;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *removedInfoContainers;
+@property (nonatomic, assign) unsigned long long infoToken;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, RenewalSchedule *> *renewalSchedules;
+@property (nonatomic, strong) dispatch_queue_t renewalQueue;
+@property (nonatomic, strong) dispatch_source_t renewalTimer;
+@property (nonatomic, strong) JSValue *renewalCallback;
+@property (nonatomic, assign) bool isBackgroundRenewalEnabled;
+@property (nonatomic, strong) NSMutableSet<NSString *> *notifiedRenewals;
+@property (strong) ContainerDirectory *directory;
 @end
 
 @implementation HIDApproveSDKWrapper : NSObject
 
+static BOOL prewarmOnInit = NO;
+static NSUInteger sharedContainerGeneration = 0;
+static NSUInteger sharedCredentialGeneration = 0;
+static NSUInteger sharedBioStateGeneration = 0;
+
+/**
+* This method is used to start the prewarm automatically when a wrapper is constructed.
+* It should be called once at app launch, before the wrapper is created.
+*
+* @param enabled - YES to prewarm on init.
+*/
++ (void)setPrewarmOnInit:(BOOL)enabled {
+    prewarmOnInit = enabled;
+}
+
+- (instancetype)init {
+    return [self initWithParent:nil userId:nil];
+}
+
+/**
+* This private initializer creates a wrapper, or when parent is set a session of the parent bound to userId.
+* A session shares the parent's device, prewarm, foreground observer and the caches keyed by container or key
+* (TOTP codes, signature challenges, signing sessions, direct client signature keys and renewal schedules).
+* It keeps its own transaction cache and expiry wheel, which report to its own transaction event callback.
+*
+* @param parent - The wrapper owning the session, nil for a wrapper.
+* @param userId - The normalized userId of the session, nil for a wrapper.
+*/
+- (instancetype)initWithParent:(HIDApproveSDKWrapper *)parent userId:(NSString *)userId {
+    self = [super init];
+    if (self) {
+        if (parent != nil) {
+            _parentWrapper = parent;
+            _username = userId;
+            _isUserBound = true;
+            _totpCodeCache = parent.totpCodeCache;
+            _signatureChallengeCache = parent.signatureChallengeCache;
+            _signingSessions = parent.signingSessions;
+            _dcsKeyHandles = parent.dcsKeyHandles;
+            _renewalSchedules = parent.renewalSchedules;
+            _snapshotQueue = parent.snapshotQueue;
+        } else {
+            _totpCodeCache = [[TOTPCodeCache alloc] init];
+            _signatureChallengeCache = [[ExpiringLRUCache alloc] initWithCapacity:SIGNATURE_CHALLENGE_CACHE_CAPACITY];
+            _signingSessions = [[ExpiringLRUCache alloc] initWithCapacity:SIGNATURE_CHALLENGE_CACHE_CAPACITY];
+            _dcsKeyHandles = [NSMutableDictionary dictionary];
+            _renewalSchedules = [NSMutableDictionary dictionary];
+            _snapshotQueue = dispatch_queue_create("com.hid.approvesdkwrapper.loginflowsnapshot", DISPATCH_QUEUE_SERIAL);
+            dispatch_set_target_queue(_snapshotQueue, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+        }
+        _transactionCache = [[ExpiringLRUCache alloc] initWithCapacity:TRANSACTION_CACHE_CAPACITY];
+        _transactionFetches = [NSMutableDictionary dictionary];
+        _pendingSyncStates = [NSMutableDictionary dictionary];
+        _expiredTransactions = [[ExpiringLRUCache alloc] initWithCapacity:TRANSACTION_CACHE_CAPACITY];
+        _userSessions = [NSMutableDictionary dictionary];
+        _seenContainerGeneration = self.containerGeneration;
+        _infoFields = [NSMutableDictionary dictionary];
+        _removedInfoContainers = [NSMutableDictionary dictionary];
+        _notifiedRenewals = [NSMutableSet set];
+        _renewalQueue = dispatch_queue_create("com.hid.approvesdkwrapper.renewal", DISPATCH_QUEUE_SERIAL);
+        dispatch_set_target_queue(_renewalQueue, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+        _transactionMonitor = [[TransactionMonitor alloc] init];
+        __weak HIDApproveSDKWrapper *weakSelf = self;
+        _expiryWheel = [[ExpiryTimerWheel alloc] initWithExpiryHandler:^(NSString *txID) {
+            [weakSelf onTransactionExpired:txID];
+        }];
+        if (parent == nil) {
+            // Biometric enrollment can change in the device settings (NotEnrolled, InvalidKey) without any wrapper call
+            _foregroundObserver = [[NSNotificationCenter defaultCenter] addObserverForName:UIApplicationWillEnterForegroundNotification object:nil queue:nil usingBlock:^(NSNotification *note) {
+                [weakSelf revalidateBioStates];
+            }];
+            if (prewarmOnInit) {
+                [self prewarm];
+            }
+        }
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_foregroundObserver != nil) {
+        [[NSNotificationCenter defaultCenter] removeObserver:_foregroundObserver];
+    }
+}
+
+/**
+* This method returns a session bound to one user. The session is a wrapper whose single-user methods always act on
+* that user's container: setUsername, retreiveTransaction and setContainerFriendlyName do not move it to another user,
+* and it resolves its own container and protection policy. Operations on sessions of different users can therefore
+* run concurrently. Sessions share this wrapper's device, prewarm and container caches, and are dropped when the
+* containers change. The wrapper itself remains the default session, following setUsername.
+*
+* @param userId - The userId of the container.
+*
+* @return HIDApproveSDKWrapper - The session for the user, reused across calls.
+*/
+-(HIDApproveSDKWrapper *)sessionForUser:(NSString *)userId{
+    NSString *normalizedUserId = [ContainerDirectory normalizedUserId:userId];
+    if ([self isEmptyString:normalizedUserId]) {
+        return self;
+    }
+    HIDApproveSDKWrapper *parent = self.parentWrapper;
+    if (parent != nil) {
+        return [parent sessionForUser:normalizedUserId];
+    }
+    @synchronized (self.userSessions) {
+        HIDApproveSDKWrapper *session = self.userSessions[normalizedUserId];
+        if (session == nil) {
+            session = [[HIDApproveSDKWrapper alloc] initWithParent:self userId:normalizedUserId];
+            self.userSessions[normalizedUserId] = session;
+            NSLog(@"ApproveSDKWrapper ---> HID:sessionForUser Created session for %@", normalizedUserId);
+        }
+        return session;
+    }
+}
+
+/**
+* The container generation is shared by every wrapper of the process, since containers are device wide:
+* a change made through one session invalidates the state cached by the others.
+*/
+- (NSUInteger)containerGeneration {
+    @synchronized ([HIDApproveSDKWrapper class]) {
+        return sharedContainerGeneration;
+    }
+}
+
+- (void)setContainerGeneration:(NSUInteger)containerGeneration {
+    @synchronized ([HIDApproveSDKWrapper class]) {
+        sharedContainerGeneration = containerGeneration;
+    }
+    self.seenContainerGeneration = containerGeneration;
+}
+
+/**
+* The credential generation changes only with the credentials or the user (create, renew, delete, password,
+* biometrics, setUsername). Cached TOTP codes are keyed by it, so container metadata changes such as a new
+* friendly name do not drop them.
+*/
+- (NSUInteger)credentialGeneration {
+    @synchronized ([HIDApproveSDKWrapper class]) {
+        return sharedCredentialGeneration;
+    }
+}
+
+/**
+* The biometric state generation changes when biometrics are enabled or disabled through any wrapper or session, and
+* when the app returns to the foreground. Biometric state tables built for an older generation are rebuilt.
+*/
+- (NSUInteger)bioStateGeneration {
+    @synchronized ([HIDApproveSDKWrapper class]) {
+        return sharedBioStateGeneration;
+    }
+}
+
+/**
+* This private method drops the container caches of this wrapper if another session changed the containers.
+*/
+- (void)syncContainerGeneration {
+    NSUInteger generation = self.containerGeneration;
+    if (self.seenContainerGeneration == generation) {
+        return;
+    }
+    [self.signatureChallengeCache removeAllObjects];
+    [self.signingSessions removeAllObjects];
+    @synchronized (self.dcsKeyHandles) {
+        [self.dcsKeyHandles removeAllObjects];
+        self.bioStates = nil;
+    }
+    @synchronized (self.renewalSchedules) {
+        [self.renewalSchedules removeAllObjects];
+    }
+    self.seenContainerGeneration = generation;
+}
+
+/**
+* This private method records the user of the current operation. A session bound to a user keeps its user.
+*
+* @param username - The userId of the container the operation resolved.
+* @param caller - The calling method, for logging.
+*
+* @return bool - false if this is a session bound to a different user, true otherwise.
+*/
+- (bool)adoptUsername:(NSString *)username from:(NSString *)caller {
+    if (self.isUserBound) {
+        if (![[ContainerDirectory normalizedUserId:username] isEqualToString:_username]) {
+            NSLog(@"ApproveSDKWrapper ---> HID:%@ Session for %@ keeps its user, ignoring %@", caller, _username, username);
+            return false;
+        }
+        return true;
+    }
+    _username = username;
+    return true;
+}
+
+/**
+* This private method returns the protection policy of the current user's container, read once per container generation.
+*
+* @param error - On failure, the error returned by the SDK.
+*
+* @return id<HIDProtectionPolicy> - The policy, or nil if there is no container.
+*/
+- (id<HIDProtectionPolicy>)sessionProtectionPolicy:(NSError **)error {
+    id<HIDContainer> pContainer = [self getSingleUserContainer];
+    UserSession *session = self.session;
+    if (session != nil && session.container == pContainer) {
+        return [session protectionPolicy:error];
+    }
+    return [pContainer getProtectionPolicy:error];
+}
+
+/**
+* This method initializes the HID SDK at utility QoS so that the first wrapper call does not pay for it:
+* device acquisition, container enumeration, the direct client signature key index and the login flow snapshot
+* (which includes the protection policies). Calls made while the prewarm runs wait for it, for up to
+* PREWARM_WAIT_TIMEOUT_SECONDS, instead of repeating the work. Calling it again after it completed is a no-op
+* unless it was cancelled.
+*/
+-(void)prewarm{
+    HIDApproveSDKWrapper *parent = self.parentWrapper;
+    if (parent != nil) {
+        [parent prewarm];
+        return;
+    }
+    dispatch_group_t prewarmGroup;
+    @synchronized (self) {
+        if (self.prewarmGroup != nil) {
+            return;
+        }
+        prewarmGroup = dispatch_group_create();
+        self.prewarmGroup = prewarmGroup;
+        self.isPrewarmCancelled = false;
+        self.isPrewarmFinished = false;
+    }
+    NSLog(@"ApproveSDKWrapper ---> HID:prewarm Prewarm started");
+    // Not background: callers of getDevice block on this group
+    dispatch_group_async(prewarmGroup, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        NSError *deviceError = nil;
+        NSError *containerError = nil;
+        HIDConnectionConfiguration *connectionConfig = [[HIDConnectionConfiguration alloc] init];
+        id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+        if (deviceError != nil || pDevice == nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:prewarm error while fetching device %@", [deviceError localizedDescription]);
+            [self endPrewarm:prewarmGroup];
+            return;
+        }
+        self.device = pDevice;
+        if (self.isPrewarmCancelled) {
+            [self endPrewarm:prewarmGroup];
+            return;
+        }
+        NSArray *pContainers = [pDevice findContainers:[[NSMutableArray alloc] init] error:&containerError];
+        for (id<HIDContainer> container in pContainers) {
+            if (self.isPrewarmCancelled) {
+                break;
+            }
+            [self dcsKeyForContainer:container withLabel:PUSH_KEY_PUBLIC_LABEL error:nil];
+        }
+        if (containerError == nil && !self.isPrewarmCancelled) {
+            NSDictionary *snapshot = [self buildLoginFlowSnapshot:pContainers];
+            dispatch_async(self.snapshotQueue, ^{
+                [self writeLoginFlowSnapshot:snapshot];
+            });
+        }
+        [self endPrewarm:prewarmGroup];
+    });
+}
+
+/**
+* This method cancels a running prewarm. Work already done is kept, and a later prewarm call starts over,
+* including after a prewarm that had already completed.
+*/
+-(void)cancelPrewarm{
+    HIDApproveSDKWrapper *parent = self.parentWrapper;
+    if (parent != nil) {
+        [parent cancelPrewarm];
+        return;
+    }
+    NSLog(@"ApproveSDKWrapper ---> HID:cancelPrewarm Prewarm cancelled");
+    @synchronized (self) {
+        self.isPrewarmCancelled = true;
+        if (self.isPrewarmFinished) {
+            self.prewarmGroup = nil;
+        }
+    }
+}
+
+/**
+* This private method finishes a prewarm, allowing a new one if it was cancelled.
+*
+* @param prewarmGroup - The group of the finishing prewarm.
+*/
+- (void)endPrewarm:(dispatch_group_t)prewarmGroup {
+    @synchronized (self) {
+        if (self.prewarmGroup == prewarmGroup) {
+            self.isPrewarmFinished = true;
+            if (self.isPrewarmCancelled) {
+                self.prewarmGroup = nil;
+            }
+        }
+    }
+    NSLog(@"ApproveSDKWrapper ---> HID:prewarm Prewarm finished%@", self.isPrewarmCancelled ? @" (cancelled)" : @"");
+}
+
+/**
+* This private method returns the HID device, waiting for a running prewarm and reusing the device it acquired.
+* Sessions use the device of their parent wrapper.
+* If the prewarm does not finish within PREWARM_WAIT_TIMEOUT_SECONDS, or the caller is on the main thread, the device
+* is acquired directly.
+*
+* @param error - On failure, the device error.
+*
+* @return id<HIDDevice> - The device, or nil on failure.
+*/
+- (id<HIDDevice>)getDevice:(NSError **)error {
+    HIDApproveSDKWrapper *parent = self.parentWrapper;
+    if (parent != nil) {
+        return [parent getDevice:error];
+    }
+    //Never hold the main thread on the prewarm, acquire the device directly there instead
+    dispatch_group_t prewarmGroup = [NSThread isMainThread] ? nil : self.prewarmGroup;
+    if (prewarmGroup != nil && dispatch_group_wait(prewarmGroup, dispatch_time(DISPATCH_TIME_NOW, PREWARM_WAIT_TIMEOUT_SECONDS * NSEC_PER_SEC)) != 0) {
+        NSLog(@"ApproveSDKWrapper ---> HID:getDevice Prewarm still running, acquiring the device directly");
+    }
+    id<HIDDevice> pDevice = self.device;
+    if (pDevice != nil) {
+        return pDevice;
+    }
+    HIDConnectionConfiguration *connectionConfig = [[HIDConnectionConfiguration alloc] init];
+    NSError *deviceError = nil;
+    pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+    if (deviceError != nil) {
+        if (error) {
+            *error = deviceError;
+        }
+        return nil;
+    }
+    self.device = pDevice;
+    return pDevice;
+}
+
 /**
 * This method is used to create the container.
 *
@@ -196,13 +1212,13 @@
         NSData *objectData = [activationCode dataUsingEncoding:NSUTF8StringEncoding];
         NSDictionary *acJson = [NSJSONSerialization JSONObjectWithData:objectData
                                                                options:NSJSONReadingMutableContainers
-                                                                 error:&jsonError];        HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
+                                                                 error:&jsonError];
         if(jsonError != nil){
             NSLog(@"ApproveSDKWrapper ---> HID:createContainer %@",[jsonError localizedDescription]);
             [self executeGenericCallback:(ExceptionCallback) withParams:(@[@"Invalid ActivationCode Format",[jsonError localizedDescription]])];
             return;
         }
-        id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+        id<HIDDevice> pDevice = [self getDevice:&deviceError];
         HIDContainerInitialization *containerInitialization = [[HIDContainerInitialization alloc] init];
         NSLog(@"ApproveSDKWrapper ---> HID:createContainer Provision String: %@" ,activationCode);
         if([[acJson allKeys] containsObject:CONTAINER_FLOW_IDENTIFIER]){
@@ -216,10 +1232,8 @@
             containerInitialization.inviteCode = [acJson objectForKey:AC_INVITE_CODE_KEY];
         }
         if(![self isEmptyString:PushId]){
-            NSData *pushIdData = [self  dataFromHexString:PushId];
-            NSString* pushIDFinal = [pushIdData base64EncodedStringWithOptions:NSUTF8StringEncoding];
-            NSLog(@"ApproveSDKWrapper ---> HID:createContainer PushId after Encoding is %@",pushIDFinal);
-            containerInitialization.pushId =pushIDFinal;
+            self.lastPushId = PushId;
+            containerInitialization.pushId = [self encodedPushId:PushId];
         }
         self.eventListener = [[ContainerEventListener alloc] initWithParams:(pwdCallback) withExceptionCallback:(ExceptionCallback)];
         id<HIDContainer> pContainer = [pDevice createContainer:containerInitialization  withSessionPassword:nil withListener:self.eventListener error:&containerError];
@@ -278,6 +1292,10 @@
             }
         }else{
             NSLog(@"ApproveSDKWrapper ---> HID:createContainer Container Creation Complete");
+            [self invalidateCredentialCaches];
+            [self containersDidChange];
+            //Without a Push ID, drop any hash left by a deleted container with the same id and user
+            [self setRegisteredPushIdHash:(containerInitialization.pushId != nil ? [self pushIdHash:containerInitialization.pushId] : nil) forContainer:pContainer];
             [self executeGenericCallback:(ExceptionCallback) withParams:(@[@"No  Error",@"success"])];
         }});
     
@@ -387,11 +1405,163 @@
             }
         }else{
             NSLog(@"ApproveSDKWrapper ---> HID:renewContainer Container Renewal Succesful");
+            [self didRenewContainer:currentContainer];
             [self executeGenericCallback:(ExceptionCallback) withParams:(@[@"No  Error",@"success"])];
         }
     });
 }
 
+/**
+* This private method refreshes the wrapper state after a container was renewed.
+*
+* @param container - The renewed container.
+*/
+- (void)didRenewContainer:(id<HIDContainer>)container {
+    [self invalidateCredentialCaches];
+    [self containersDidChange];
+    @synchronized (self.renewalSchedules) {
+        NSString *containerId = [NSString stringWithFormat:@"%ld", (long)[container getId]];
+        [self.notifiedRenewals removeObject:containerId];
+    }
+    //Renewal is sent without a PushId, so resend the last known one
+    [self setRegisteredPushIdHash:nil forContainer:container];
+    if(![self isEmptyString:self.lastPushId]){
+        [self refreshPushId:self.lastPushId forContainers:@[container] force:YES withCallback:nil];
+    }
+}
+
+/**
+* This method starts tracking the renewal window of every container in the background.
+* Containers are checked at start and then every RENEWAL_CHECK_INTERVAL_SECONDS; once a container enters its renewal
+* window, isRenewable is checked off the critical path and a "RenewalDue" event is sent once with a JSON string
+* (userId, containerId, renewalDate, expiryDate, daysToExpiry, isRenewable).
+* If background renewal is enabled, containers protected by a device policy (no password needed) are renewed right away
+* and "RenewalComplete" (userId) or "RenewalFailed" (userId, exception) is sent instead.
+*
+* @param renewalCallback - The callback receiving the renewal events.
+* @param backgroundRenewal - true to renew passwordless containers in the background.
+*/
+-(void)startRenewalScheduler:(JSValue *)renewalCallback withBackgroundRenewal:(bool)backgroundRenewal{
+    dispatch_async(self.renewalQueue, ^{
+        self.renewalCallback = renewalCallback;
+        self.isBackgroundRenewalEnabled = backgroundRenewal;
+        if (self.renewalTimer != nil) {
+            [self checkRenewals];
+            return;
+        }
+        __weak HIDApproveSDKWrapper *weakSelf = self;
+        self.renewalTimer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, self.renewalQueue);
+        dispatch_source_set_timer(self.renewalTimer, dispatch_time(DISPATCH_TIME_NOW, 0),
+                                  RENEWAL_CHECK_INTERVAL_SECONDS * NSEC_PER_SEC, RENEWAL_CHECK_LEEWAY_SECONDS * NSEC_PER_SEC);
+        dispatch_source_set_event_handler(self.renewalTimer, ^{
+            [weakSelf checkRenewals];
+        });
+        dispatch_resume(self.renewalTimer);
+        NSLog(@"ApproveSDKWrapper ---> HID:startRenewalScheduler Renewal scheduler started");
+    });
+}
+
+/**
+* This method stops the renewal scheduler.
+*/
+-(void)stopRenewalScheduler{
+    dispatch_async(self.renewalQueue, ^{
+        if (self.renewalTimer != nil) {
+            dispatch_source_cancel(self.renewalTimer);
+            self.renewalTimer = nil;
+        }
+        self.renewalCallback = nil;
+        NSLog(@"ApproveSDKWrapper ---> HID:stopRenewalScheduler Renewal scheduler stopped");
+    });
+}
+
+/**
+* This private method checks the renewal window of every container. Runs on the renewal queue.
+*/
+- (void)checkRenewals {
+    NSError *error = nil;
+    id<HIDDevice> pDevice = [self getDevice:&error];
+    NSArray *pContainers = [pDevice findContainers:[[NSMutableArray alloc] init] error:&error];
+    if (error != nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:checkRenewals error while fetching containers %@", [error localizedDescription]);
+        return;
+    }
+    int64_t now = [RenewalSchedule currentMillis];
+    for (id<HIDContainer> container in pContainers) {
+        RenewalSchedule *schedule = [self renewalScheduleForContainer:container error:nil];
+        if (schedule == nil) {
+            continue;
+        }
+        bool isDue = schedule.renewalDate != nil ? now >= (int64_t)([schedule.renewalDate timeIntervalSince1970] * 1000)
+                                                 : [schedule finalDaysAt:now] >= 0;
+        if (!isDue) {
+            continue;
+        }
+        NSString *containerId = [NSString stringWithFormat:@"%ld", (long)[container getId]];
+        NSError *renewableError = nil;
+        Boolean isRenewable = [container isRenewable:@"" error:&renewableError];
+        if (renewableError != nil) {
+            //Not known either way, check again on the next run
+            NSLog(@"ApproveSDKWrapper ---> HID:checkRenewals error while checking renewability of %@ %@", [container getUserId], [renewableError localizedDescription]);
+            continue;
+        }
+        bool isNotified;
+        @synchronized (self.renewalSchedules) {
+            isNotified = [self.notifiedRenewals containsObject:containerId];
+            [self.notifiedRenewals addObject:containerId];
+        }
+        if (isNotified) {
+            continue;
+        }
+        NSLog(@"ApproveSDKWrapper ---> HID:checkRenewals Renewal due for %@, renewable %@", [container getUserId], isRenewable ? @"yes" : @"no");
+        id<HIDProtectionPolicy> policy = [container getProtectionPolicy:nil];
+        if (isRenewable && self.isBackgroundRenewalEnabled && [policy policyType] == HIDPolicyTypeDevice) {
+            [self renewContainerInBackground:container];
+            continue;
+        }
+        NSMutableDictionary *renewalInfo = [NSMutableDictionary dictionary];
+        renewalInfo[@"userId"] = [container getUserId];
+        renewalInfo[@"containerId"] = containerId;
+        renewalInfo[@"renewalDate"] = schedule.renewalDate != nil ? [[self infoDateFormatter] stringFromDate:schedule.renewalDate] : nil;
+        renewalInfo[@"expiryDate"] = [[self infoDateFormatter] stringFromDate:[NSDate dateWithTimeIntervalSince1970:schedule.expiryMillis / 1000.0]];
+        renewalInfo[@"daysToExpiry"] = @([schedule daysToExpiryAt:now]);
+        renewalInfo[@"isRenewable"] = isRenewable ? @"true" : @"false";
+        NSData *jsonData = [NSJSONSerialization dataWithJSONObject:renewalInfo options:NSJSONWritingPrettyPrinted error:nil];
+        if (jsonData != nil) {
+            [self executeGenericCallback:self.renewalCallback withParams:@[@"RenewalDue", [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding]]];
+        }
+    }
+}
+
+/**
+* This private method renews a container protected by a device policy without user interaction. Runs on the renewal queue.
+*
+* @param container - The container to renew.
+*/
+- (void)renewContainerInBackground:(id<HIDContainer>)container {
+    NSLog(@"ApproveSDKWrapper ---> HID:renewContainerInBackground Renewing %@", [container getUserId]);
+    HIDContainerRenewal* config = [[HIDContainerRenewal alloc] init];
+    [config setPushId:nil];
+    NSString *containerFriendlyName = [container getName];
+    if(containerFriendlyName != nil && ![containerFriendlyName isEqualToString:@""]){
+        [config setContainerFriendlyName:containerFriendlyName];
+    }
+    //Device policy containers are renewed with an empty password
+    [config setPassword:@""];
+    ContainerEventListener* renewListener = [[ContainerEventListener alloc] initWithParams:nil withExceptionCallback:nil];
+    renewListener.cancelsPasswordPrompt = true;
+    NSError *renewalError = nil;
+    [container renew:config withSessionPassword:@"" withListener:renewListener error:&renewalError];
+    if (renewalError != nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:renewContainerInBackground error while renewing container %@", [renewalError localizedDescription]);
+        [self executeGenericCallback:self.renewalCallback withParams:@[@"RenewalFailed", [container getUserId], [self transactionExceptionName:(int)[renewalError code]]]];
+        return;
+    }
+    NSLog(@"ApproveSDKWrapper ---> HID:renewContainerInBackground Container Renewal Succesful");
+    [self didRenewContainer:container];
+    [self executeGenericCallback:self.renewalCallback withParams:@[@"RenewalComplete", [container getUserId]]];
+}
+
 /**
 * This method is used to get the number of days between the start and end date.
 *
@@ -401,10 +1571,7 @@
 * @returns NSInteger - The number of days between the start and end date.
 */
 - (NSInteger) numberOfDaysBetween:(NSDate *)startDate toDate:(NSDate *)endDate {
-    unsigned int unitFlags = NSCalendarUnitDay;
-    NSCalendar *gregorianCalendar = [[NSCalendar alloc] initWithCalendarIdentifier:NSCalendarIdentifierGregorian];
-    NSDateComponents *comps = [gregorianCalendar components:unitFlags fromDate:startDate  toDate:endDate  options:0];
-    return [comps day];
+    return [RenewalSchedule daysFrom:startDate to:endDate];
 }
 
 /**
@@ -417,7 +1584,10 @@
 */
 -(int) getContainerRenewableData:(id<HIDContainer>)container callback:(JSValue *)genericExecuteCallback{
     NSError* error;
-    NSDate *renewalDate = [container getRenewalDate:&error];
+    NSDate *renewalDate = [[self renewalScheduleForContainer:container error:&error] renewalDate];
+    if(renewalDate == nil && error == nil){
+        renewalDate = [container getRenewalDate:&error];
+    }
     if(error != nil){
         NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData error while fetching container Renewal %@", [error localizedDescription]);
         [self executeGenericCallback:(genericExecuteCallback) withParams:(@[@"Renewal Error",[error localizedDescription]])];
@@ -433,6 +1603,22 @@
     return remainingDays;
 }
 
+/**
+* This method returns the formatter used for the dates reported by getInfo, created once.
+* NSDateFormatter is thread safe for formatting, so the instance is shared.
+*
+* @return NSDateFormatter - The "EEE MMM dd HH:mm:ss z yyyy" formatter.
+*/
+- (NSDateFormatter *)infoDateFormatter {
+    static NSDateFormatter *formatter;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        formatter = [[NSDateFormatter alloc] init];
+        formatter.dateFormat = @"EEE MMM dd HH:mm:ss z yyyy";
+    });
+    return formatter;
+}
+
 /**
 * This method is used to get the Container Renewable Date.
 *
@@ -442,26 +1628,51 @@
     id<HIDContainer> pContainer = [self getSingleUserContainer];
     NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData HID In getContainerRenewableDate");
     NSError *error = nil;
-    NSDate *expiryDate = [pContainer getExpiryDate:&error];
-    if (error) {
-        NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData Error getting expiry date: %@", [error localizedDescription]);
-        return (pow(10, 9) + 7);
+    RenewalSchedule *schedule = [self renewalScheduleForContainer:pContainer error:&error];
+    if (schedule == nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData Error getting container dates: %@", [error localizedDescription]);
+        return RENEWAL_DATE_ERROR;
     }
-    
-    NSDate *creationDate = [pContainer getCreationDate:&error];
-    if (error) {
-        NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData Error getting creation date: %@", [error localizedDescription]);
-        return (pow(10, 9) + 7);
+    NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData Container Expiry Date is %lld", schedule.expiryMillis);
+    NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData Container Creation Date is %lld", schedule.creationMillis);
+    return [schedule finalDaysAt:[RenewalSchedule currentMillis]];
+}
+
+/**
+* This method returns the renewal schedule of the container, read from the SDK once per container generation.
+*
+* @param container - The container.
+* @param error - On failure, the error returned while reading the expiry or creation date.
+*
+* @return RenewalSchedule - The schedule, or nil on failure.
+*/
+-(RenewalSchedule *)renewalScheduleForContainer:(id<HIDContainer>)container error:(NSError **)error {
+    [self syncContainerGeneration];
+    NSString *containerKey = [NSString stringWithFormat:@"%ld", (long)[container getId]];
+    @synchronized (self.renewalSchedules) {
+        RenewalSchedule *schedule = self.renewalSchedules[containerKey];
+        if (schedule != nil) {
+            return schedule;
+        }
     }
-    
-    NSTimeInterval containerExpiry = [expiryDate timeIntervalSince1970];
-    NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData Container Expiry Date is %f", containerExpiry);
-    NSTimeInterval containerStart = [creationDate timeIntervalSince1970];
-    NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData Container Creation Date is %f", containerStart);
-    int startDays = [self getDaysFromMilli:[self getWrtCurrentTime:containerStart*1000]];
-    int endDays = [self getDaysFromMilli:[self getWrtCurrentTime:containerExpiry*1000]];
-    int totalDays = [self getDaysFromMilli:(labs(containerExpiry - containerStart) * 1000)];
-    return [self calFinalDays:totalDays end:endDays];
+    NSUInteger generation = self.containerGeneration;
+    NSError *dateError = nil;
+    NSDate *expiryDate = [container getExpiryDate:&dateError];
+    NSDate *creationDate = dateError == nil ? [container getCreationDate:&dateError] : nil;
+    if (dateError != nil) {
+        if (error) {
+            *error = dateError;
+        }
+        return nil;
+    }
+    NSDate *renewalDate = [container getRenewalDate:nil];
+    RenewalSchedule *schedule = [[RenewalSchedule alloc] initWithCreationDate:creationDate expiryDate:expiryDate renewalDate:renewalDate];
+    @synchronized (self.renewalSchedules) {
+        if (generation == self.containerGeneration) {
+            self.renewalSchedules[containerKey] = schedule;
+        }
+    }
+    return schedule;
 }
 
 /**
@@ -475,9 +1686,7 @@
 -(int)calFinalDays:(int)total end:(int)end {
     NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData  calFinalDays Total Days is %d", total);
     NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData  calFinalDays End Days is %d", end);
-    float perc = ((float)end / (float)total) * 100;
-    NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData  calFinalDays Percentage is %f", perc);
-    if (end<=2 || perc < 20.0f) return end;  // if 2 or fewer days are left || percentage is in last 20% of expiry time
+    if (end <= 2 || (long long)end * 5 < total) return end;  // if 2 or fewer days are left || in the last 20% of expiry time
     NSLog(@"ApproveSDKWrapper ---> HID:getContainerRenewableData  calFinalDays Returning %d", (-1 * end));
     return (-1 * end);
 }
@@ -544,12 +1753,26 @@
 * @return NSString - "Register" if not registered, "SingleLogin,userId" if single container exists, "MultiLogin,userId1|userId2|..." if multiple containers exist
 */
 -(NSString *)getLoginFlow:(NSString *)pushId callBack:(JSValue *)genericExecutionCallback{
+    return [self getLoginFlow:pushId callBack:genericExecutionCallback withPushIdCallback:nil];
+}
+
+/**
+* This method is used to get the Login Flow whether the User is registered or not and if registered how many containers are present.
+* The Push ID refresh runs in the background after the login type is determined and does not delay the returned value.
+*
+* @param pushId - The Push ID to be set for the containers.
+* @param genericExecutionCallback - The callback to handle the response.
+* @param pushIdCallback - Optional callback receiving the per-container Push ID update results as JSON.
+*
+* @return NSString - "Register" if not registered, "SingleLogin,userId" if single container exists, "MultiLogin,userId1|userId2|..." if multiple containers exist
+*/
+-(NSString *)getLoginFlow:(NSString *)pushId callBack:(JSValue *)genericExecutionCallback withPushIdCallback:(JSValue *)pushIdCallback{
     NSLog(@"ApproveSDKWrapper ---> HID:getLoginFlow GetLoginFlow New called from Wrapper Framework with new change");
     NSLog(@"ApproveSDKWrapper ---> HID:getLoginFlow PushID is %@",pushId);
     NSError* deviceError;
     NSError* containerError;
-    HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-    id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+    NSUInteger generation = self.containerGeneration;
+    id<HIDDevice> pDevice = [self getDevice:&deviceError];
     
     if (deviceError != nil) {
         NSLog(@"ApproveSDKWrapper ---> HID:getLoginFlow error while fetching Container Configuration. Device Error User Info: %@", [deviceError userInfo]);
@@ -584,57 +1807,452 @@
         return @"Error";
     }
     
+    [self cacheContainerDirectory:[[ContainerDirectory alloc] initWithContainers:pContainers generation:generation]];
+    NSString *loginFlow = [self loginFlowForContainers:pContainers];
+    
     if ([pContainers count] == 0) {
         NSLog(@"ApproveSDKWrapper ---> HID:getLoginFlow No Containers Found, prompting for register");
-        return @"Register";
+    } else if (![self isEmptyString:pushId]) {
+        self.lastPushId = pushId;
+        [self refreshPushId:pushId forContainers:pContainers force:NO withCallback:pushIdCallback];
     }
     
-    if ([pContainers count] == 1) {
-        if (![self isEmptyString:pushId]) {
-            [self updatePushIdForContainer:pContainers[0] pushId:pushId];
+    dispatch_async(self.snapshotQueue, ^{
+        [self writeLoginFlowSnapshot:[self buildLoginFlowSnapshot:pContainers]];
+    });
+    
+    NSLog(@"ApproveSDKWrapper ---> HID:getLoginFlow GetLoginFlowString is %@", loginFlow);
+    return loginFlow;
+}
+
+/**
+* This private method builds the login flow string for the given containers.
+*
+* @param containers - The containers found on the device.
+*
+* @return NSString - "Register", "SingleLogin,userId" or "MultiLogin,userId1|userId2|..."
+*/
+- (NSString *)loginFlowForContainers:(NSArray *)containers {
+    if ([containers count] == 0) {
+        return @"Register";
+    }
+    if ([containers count] == 1) {
+        return [@"SingleLogin," stringByAppendingString:[containers[0] getUserId]];
+    }
+    NSMutableArray *userIds = [NSMutableArray arrayWithCapacity:[containers count]];
+    for (id<HIDContainer> pContainerLoop in containers) {
+        [userIds addObject:[pContainerLoop getUserId]];
+    }
+    return [@"MultiLogin," stringByAppendingString:[userIds componentsJoinedByString:@"|"]];
+}
+
+/**
+* This method returns the last persisted login flow snapshot so the first screen can render without touching the SDK,
+* and reconciles the snapshot against the SDK in the background.
+*
+* @param reconcileCallback - Optional callback receiving ("changed" or "unchanged", snapshotJSON) once reconciled,
+*                            or ("failure", message) if the containers could not be read.
+*
+* @return NSString - A JSON string with the loginFlow and containers (containerId, userId, friendlyName, renewalDate,
+*                    expiryDate, keyLabels, bioState), or nil if no snapshot has been persisted yet.
+*/
+-(NSString *)getLoginFlowSnapshot:(JSValue *)reconcileCallback{
+    NSDictionary *snapshot = [self readLoginFlowSnapshot];
+    dispatch_async(self.snapshotQueue, ^{
+        NSError *error = nil;
+        NSDictionary *currentSnapshot = [self reconcileLoginFlowSnapshot:&error];
+        if (reconcileCallback == nil) {
+            return;
         }
-        
-        NSString *loginType = @"SingleLogin,";
-        NSString *username = [pContainers[0] getUserId];
-        
-        [self getInfo];
-        [self getKeyList];
-        
-        NSLog(@"ApproveSDKWrapper ---> HID:getLoginFlow Single Login Flow with UserId %@", username);
-        
-        return [loginType stringByAppendingString:username];
-    } else {
-        NSMutableString *multiflowString = [[NSMutableString alloc] initWithString:@"MultiLogin,"];
-        
-        for (id<HIDContainer> pContainerLoop in pContainers) {
-            if (![self isEmptyString:pushId]) {
-                [self updatePushIdForContainer:pContainerLoop pushId:pushId];
+        if (currentSnapshot == nil) {
+            [self executeGenericCallback:reconcileCallback withParams:@[@"failure", (error != nil ? [error localizedDescription] : @"Device Error")]];
+            return;
+        }
+        NSString *status = [currentSnapshot isEqualToDictionary:snapshot] ? @"unchanged" : @"changed";
+        [self executeGenericCallback:reconcileCallback withParams:@[status, [self loginFlowSnapshotJSON:currentSnapshot]]];
+    });
+    if (snapshot == nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:getLoginFlowSnapshot No snapshot persisted");
+        return nil;
+    }
+    return [self loginFlowSnapshotJSON:snapshot];
+}
+
+/**
+* This private method returns the location of the persisted login flow snapshot.
+*
+* @return NSURL - The snapshot file URL in the Application Support directory.
+*/
+- (NSURL *)loginFlowSnapshotURL {
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSURL *directory = [[fileManager URLsForDirectory:NSApplicationSupportDirectory inDomains:NSUserDomainMask] firstObject];
+    [fileManager createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+    return [directory URLByAppendingPathComponent:LOGIN_FLOW_SNAPSHOT_FILE_NAME];
+}
+
+/**
+* This private method reads the login flow snapshot, from memory if already loaded, else from the memory-mapped binary plist.
+*
+* @return NSDictionary - The snapshot, or nil if none is persisted.
+*/
+- (NSDictionary *)readLoginFlowSnapshot {
+    NSDictionary *snapshot = self.loginFlowSnapshot;
+    if (snapshot != nil) {
+        return snapshot;
+    }
+    NSData *data = [NSData dataWithContentsOfURL:[self loginFlowSnapshotURL] options:NSDataReadingMappedIfSafe error:nil];
+    if (data == nil) {
+        return nil;
+    }
+    NSError *error = nil;
+    id plist = [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListImmutable format:NULL error:&error];
+    if (![plist isKindOfClass:[NSDictionary class]] || ![plist[@"version"] isEqual:@(LOGIN_FLOW_SNAPSHOT_VERSION)]) {
+        NSLog(@"ApproveSDKWrapper ---> HID:readLoginFlowSnapshot Ignoring unreadable snapshot %@", [error localizedDescription]);
+        return nil;
+    }
+    self.loginFlowSnapshot = plist;
+    return plist;
+}
+
+/**
+* This private method persists the login flow snapshot as a binary plist, skipping the write if it is unchanged.
+* Must be called on the snapshot queue.
+*
+* @param snapshot - The snapshot to persist.
+*/
+- (void)writeLoginFlowSnapshot:(NSDictionary *)snapshot {
+    if ([snapshot isEqualToDictionary:[self readLoginFlowSnapshot]]) {
+        return;
+    }
+    self.loginFlowSnapshot = snapshot;
+    NSError *error = nil;
+    NSData *data = [NSPropertyListSerialization dataWithPropertyList:snapshot format:NSPropertyListBinaryFormat_v1_0 options:0 error:&error];
+    if (data == nil || ![data writeToURL:[self loginFlowSnapshotURL]
+                                 options:(NSDataWritingAtomic | NSDataWritingFileProtectionCompleteUntilFirstUserAuthentication)
+                                   error:&error]) {
+        NSLog(@"ApproveSDKWrapper ---> HID:writeLoginFlowSnapshot Error while writing snapshot %@", [error localizedDescription]);
+    }
+}
+
+/**
+* This private method builds the login flow snapshot for the given containers.
+*
+* @param containers - The containers found on the device.
+*
+* @return NSDictionary - The snapshot, containing only property list types.
+*/
+- (NSDictionary *)buildLoginFlowSnapshot:(NSArray *)containers {
+    NSMutableArray *containerSnapshots = [NSMutableArray arrayWithCapacity:[containers count]];
+    for (id<HIDContainer> container in containers) {
+        NSMutableDictionary *containerSnapshot = [NSMutableDictionary dictionary];
+        containerSnapshot[@"containerId"] = @([container getId]);
+        containerSnapshot[@"userId"] = [container getUserId];
+        containerSnapshot[@"friendlyName"] = [container getName];
+        containerSnapshot[@"renewalDate"] = [container getRenewalDate:nil];
+        containerSnapshot[@"expiryDate"] = [container getExpiryDate:nil];
+        NSMutableArray *keyLabels = [NSMutableArray array];
+        for (id<HIDKey> key in [container findKeys:nil error:nil]) {
+            NSString *keyLabel = [key getProperty:HID_KEY_PROPERTY_LABEL error:nil];
+            if (keyLabel != nil) {
+                [keyLabels addObject:keyLabel];
             }
-            [multiflowString appendString:[pContainerLoop getUserId]];
-            [multiflowString appendString:@"|"];
         }
-        
-        NSLog(@"ApproveSDK ---> HID:getLoginFlow GetLoginFlowString is %@", multiflowString);
-        
-        return [multiflowString substringToIndex:([multiflowString length] - 1)];
+        containerSnapshot[@"keyLabels"] = keyLabels;
+        id<HIDProtectionPolicy> policy = [container getProtectionPolicy:nil];
+        if ([policy policyType] == HIDPolicyTypeBioPassword) {
+            containerSnapshot[@"bioState"] = @([(id<HIDBioPasswordPolicy>)policy getBioAuthenticationState]);
+        }
+        [containerSnapshots addObject:containerSnapshot];
+    }
+    return @{@"version": @(LOGIN_FLOW_SNAPSHOT_VERSION),
+             @"loginFlow": [self loginFlowForContainers:containers],
+             @"containers": containerSnapshots};
+}
+
+/**
+* This private method reads the containers from the SDK and persists a fresh snapshot if it differs.
+* Must be called on the snapshot queue.
+*
+* @param error - On failure, the device or container error.
+*
+* @return NSDictionary - The current snapshot, or nil if the containers could not be read.
+*/
+- (NSDictionary *)reconcileLoginFlowSnapshot:(NSError **)error {
+    NSError *deviceError = nil;
+    NSError *containerError = nil;
+    id<HIDDevice> pDevice = [self getDevice:&deviceError];
+    NSArray *pContainers = [pDevice findContainers:[[NSMutableArray alloc] init] error:&containerError];
+    if (deviceError != nil || containerError != nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:reconcileLoginFlowSnapshot error while fetching containers %@", [(deviceError != nil ? deviceError : containerError) localizedDescription]);
+        if (error) {
+            *error = deviceError != nil ? deviceError : containerError;
+        }
+        return nil;
+    }
+    NSDictionary *snapshot = [self buildLoginFlowSnapshot:pContainers];
+    [self writeLoginFlowSnapshot:snapshot];
+    return snapshot;
+}
+
+/**
+* This private method is called once a container was created, renewed, deleted or modified. It starts a new container
+* generation so that state read during the change is not cached, and refreshes the persisted snapshot.
+*/
+- (void)containersDidChange {
+    @synchronized (self.dcsKeyHandles) {
+        self.containerGeneration += 1;
+        self.directory = nil;
+        self.session = nil;
+        self.bioStates = nil;
+    }
+    // Sessions of removed users would otherwise be kept, and sessions still in use resync on their next call
+    HIDApproveSDKWrapper *owner = self.parentWrapper != nil ? self.parentWrapper : self;
+    @synchronized (owner.userSessions) {
+        [owner.userSessions removeAllObjects];
+    }
+    [self scheduleLoginFlowSnapshotRefresh];
+}
+
+/**
+* This private method refreshes the persisted snapshot in the background.
+*/
+- (void)scheduleLoginFlowSnapshotRefresh {
+    dispatch_async(self.snapshotQueue, ^{
+        [self reconcileLoginFlowSnapshot:nil];
+    });
+}
+
+/**
+* This private method converts a login flow snapshot to JSON, formatting the dates as in getInfo.
+*
+* @param snapshot - The snapshot.
+*
+* @return NSString - The JSON string.
+*/
+- (NSString *)loginFlowSnapshotJSON:(NSDictionary *)snapshot {
+    NSDateFormatter *formatter = [self infoDateFormatter];
+    NSMutableArray *containers = [NSMutableArray array];
+    for (NSDictionary *containerSnapshot in snapshot[@"containers"]) {
+        NSMutableDictionary *containerInfo = [containerSnapshot mutableCopy];
+        for (NSString *dateKey in @[@"renewalDate", @"expiryDate"]) {
+            if (containerSnapshot[dateKey] != nil) {
+                containerInfo[dateKey] = [formatter stringFromDate:containerSnapshot[dateKey]];
+            }
+        }
+        [containers addObject:containerInfo];
+    }
+    NSDictionary *jsonObj = @{@"loginFlow": snapshot[@"loginFlow"], @"containers": containers};
+    NSError *jsonError;
+    NSData *jsonData = [NSJSONSerialization dataWithJSONObject:jsonObj options:NSJSONWritingPrettyPrinted error:&jsonError];
+    if (!jsonData) {
+        NSLog(@"ApproveSDKWrapper ---> HID:loginFlowSnapshotJSON Error while converting JSON %@", jsonError);
+        return nil;
+    }
+    return [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
+}
+
+/**
+* This method is used to update the Push ID for the Container.
+*
+* @param container - The container for which the Push ID is to be updated.
+* @param pushId - The Push ID to be set for the container.
+*/
+- (void)updatePushIdForContainer:(id<HIDContainer>)container pushId:(NSString *)pushId {
+    [self updatePushIdForContainer:container encodedPushId:[self encodedPushId:pushId] error:nil];
+}
+
+/**
+* This private method converts the hex Push ID received from JS into the base64 value expected by the server.
+*
+* @param pushId - The hex encoded Push ID.
+*
+* @return NSString - The base64 encoded Push ID.
+*/
+- (NSString *)encodedPushId:(NSString *)pushId {
+    NSData *pushIdData = [self dataFromHexString:pushId];
+    NSString *pushIDFinal = [pushIdData base64EncodedStringWithOptions:NSUTF8StringEncoding];
+    NSLog(@"ApproveSDKWrapper ---> HID:encodedPushId PushId after Encoding is %@", pushIDFinal);
+    return pushIDFinal;
+}
+
+/**
+* This private method updates an already encoded Push ID for the Container.
+*
+* @param container - The container for which the Push ID is to be updated.
+* @param pushIDFinal - The base64 encoded Push ID.
+* @param error - On failure, the error returned by the server call.
+*
+* @return BOOL - YES if the Push ID was updated.
+*/
+- (BOOL)updatePushIdForContainer:(id<HIDContainer>)container encodedPushId:(NSString *)pushIDFinal error:(NSError **)error {
+    NSError *pushIDError = nil;
+    BOOL pushIDStatus = [container updateDeviceInfo:HID_DEVICE_INFO_PUSHID withValue:pushIDFinal withPassword:nil withParams:nil error:&pushIDError];
+    NSLog(@"ApproveSDKWrapper ---> HID:updatePushIdForContainer PushID status is %@", pushIDStatus ? @"yes" : @"No");
+    if (pushIDError != nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:updatePushIdForContainer error while updating push ID %@", [pushIDError localizedDescription]);
+        if (error) {
+            *error = pushIDError;
+        }
+        return NO;
+    }
+    return pushIDStatus;
+}
+
+/**
+* This private method refreshes the Push ID of the given containers in the background.
+* The Push ID is encoded once and the server updates run concurrently, bounded by PUSH_ID_UPDATE_CONCURRENCY.
+* Containers whose last registered Push ID matches are skipped unless force is set.
+*
+* @param pushId - The hex encoded Push ID.
+* @param containers - The containers to update.
+* @param force - YES to send the Push ID even if it is unchanged.
+* @param pushIdCallback - Optional callback receiving ("success", resultsJSON) once all updates are done.
+*/
+- (void)refreshPushId:(NSString *)pushId forContainers:(NSArray *)containers force:(BOOL)force withCallback:(JSValue *)pushIdCallback {
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        NSString *pushIDFinal = [self encodedPushId:pushId];
+        NSString *pushIDHash = [self pushIdHash:pushIDFinal];
+        NSUInteger count = [containers count];
+        NSMutableArray *results = [NSMutableArray arrayWithCapacity:count];
+        for (NSUInteger i = 0; i < count; i++) {
+            [results addObject:[NSNull null]];
+        }
+        dispatch_group_t pushIdGroup = dispatch_group_create();
+        dispatch_semaphore_t pushIdSlots = dispatch_semaphore_create(PUSH_ID_UPDATE_CONCURRENCY);
+        for (NSUInteger i = 0; i < count; i++) {
+            id<HIDContainer> container = containers[i];
+            if (!force && [pushIDHash isEqualToString:[self registeredPushIdHashForContainer:container]]) {
+                NSLog(@"ApproveSDKWrapper ---> HID:refreshPushId PushId unchanged for %@, skipping update", [container getUserId]);
+                @synchronized (results) {
+                    [results replaceObjectAtIndex:i withObject:@{@"userId": [container getUserId], @"containerId": @([container getId]), @"status": @"unchanged"}];
+                }
+                continue;
+            }
+            dispatch_semaphore_wait(pushIdSlots, DISPATCH_TIME_FOREVER);
+            dispatch_group_async(pushIdGroup, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+                NSError *pushIDError = nil;
+                BOOL updated = [self updatePushIdForContainer:container encodedPushId:pushIDFinal error:&pushIDError];
+                [self setRegisteredPushIdHash:(updated ? pushIDHash : nil) forContainer:container];
+                NSMutableDictionary *result = [NSMutableDictionary dictionary];
+                result[@"userId"] = [container getUserId];
+                result[@"containerId"] = @([container getId]);
+                result[@"status"] = updated ? @"success" : @"failure";
+                if (pushIDError != nil) {
+                    int errorCode = (int)[pushIDError code];
+                    result[@"exception"] = [self transactionExceptionName:errorCode];
+                    result[@"code"] = @(errorCode);
+                }
+                @synchronized (results) {
+                    [results replaceObjectAtIndex:i withObject:result];
+                }
+                dispatch_semaphore_signal(pushIdSlots);
+            });
+        }
+        dispatch_group_wait(pushIdGroup, DISPATCH_TIME_FOREVER);
+        if (pushIdCallback == nil) {
+            return;
+        }
+        NSDictionary *jsonObj = [NSDictionary dictionaryWithObjectsAndKeys:results, @"results", nil];
+        NSError *jsonError;
+        NSData *jsonData = [NSJSONSerialization dataWithJSONObject:jsonObj options:NSJSONWritingPrettyPrinted error:&jsonError];
+        if (!jsonData) {
+            NSLog(@"ApproveSDKWrapper ---> HID:refreshPushId Error while converting JSON %@", jsonError);
+            [self executeGenericCallback:pushIdCallback withParams:@[@"failure", [jsonError localizedDescription]]];
+        } else {
+            NSString *jsonString = [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
+            [self executeGenericCallback:pushIdCallback withParams:@[@"success", jsonString]];
+        }
+    });
+}
+
+/**
+* This method is used to force a Push ID update for every container, even if the Push ID is unchanged.
+*
+* @param pushId - The hex encoded Push ID. If empty, the last Push ID received from getLoginFlow or createContainer is used.
+* @param pushIdCallback - Callback receiving the per-container Push ID update results as JSON.
+*/
+-(void)refreshPushId:(NSString *)pushId withCallback:(JSValue *)pushIdCallback{
+    NSString *pushIdToSend = [self isEmptyString:pushId] ? self.lastPushId : pushId;
+    if ([self isEmptyString:pushIdToSend]) {
+        NSLog(@"ApproveSDKWrapper ---> HID:refreshPushId No PushId available");
+        [self executeGenericCallback:pushIdCallback withParams:@[@"failure", @"PushId is empty"]];
+        return;
+    }
+    self.lastPushId = pushIdToSend;
+    NSError *deviceError = nil;
+    NSError *containerError = nil;
+    id<HIDDevice> pDevice = [self getDevice:&deviceError];
+    NSArray *pContainers = [pDevice findContainers:[[NSMutableArray alloc] init] error:&containerError];
+    if (deviceError != nil || containerError != nil) {
+        NSError *error = deviceError != nil ? deviceError : containerError;
+        NSLog(@"ApproveSDKWrapper ---> HID:refreshPushId error while fetching containers %@", [error localizedDescription]);
+        [self executeGenericCallback:pushIdCallback withParams:@[[self transactionExceptionName:(int)[error code]], [error localizedDescription]]];
+        return;
     }
+    [self refreshPushId:pushIdToSend forContainers:pContainers force:YES withCallback:pushIdCallback];
 }
 
 /**
-* This method is used to update the Push ID for the Container.
+* This private method returns the SHA-256 hex digest of the encoded Push ID, so the Push ID itself is not persisted.
 *
-* @param container - The container for which the Push ID is to be updated.
-* @param pushId - The Push ID to be set for the container.
+* @param pushIDFinal - The base64 encoded Push ID.
+*
+* @return NSString - The hex digest.
 */
-- (void)updatePushIdForContainer:(id<HIDContainer>)container pushId:(NSString *)pushId {
-    NSData *pushIdData = [self dataFromHexString:pushId];
-    NSString *pushIDFinal = [pushIdData base64EncodedStringWithOptions:NSUTF8StringEncoding];
-    NSLog(@"ApproveSDKWrapper ---> HID:updatePushIdForContainer PushId after Encoding is %@", pushIDFinal);
-    NSError *pushIDError = nil;
-    BOOL pushIDStatus = [container updateDeviceInfo:HID_DEVICE_INFO_PUSHID withValue:pushIDFinal withPassword:nil withParams:nil error:&pushIDError];
-    NSLog(@"ApproveSDKWrapper ---> HID:updatePushIdForContainer PushID status is %@", pushIDStatus ? @"yes" : @"No");
-    if (pushIDError != nil) {
-        NSLog(@"ApproveSDKWrapper ---> HID:updatePushIdForContainer error while updating push ID %@", [pushIDError localizedDescription]);
+- (NSString *)pushIdHash:(NSString *)pushIDFinal {
+    NSData *data = [pushIDFinal dataUsingEncoding:NSUTF8StringEncoding];
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
+    NSMutableString *hash = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    for (int i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        [hash appendFormat:@"%02x", digest[i]];
+    }
+    return hash;
+}
+
+/**
+* This private method returns the key under which the Push ID hash of a container is persisted.
+*
+* @param container - The container.
+*
+* @return NSString - The persisted key.
+*/
+- (NSString *)pushIdHashKeyForContainer:(id<HIDContainer>)container {
+    return [NSString stringWithFormat:@"%ld|%@", (long)[container getId], [container getUserId]];
+}
+
+/**
+* This private method returns the hash of the last Push ID successfully registered for the container.
+*
+* @param container - The container.
+*
+* @return NSString - The hash, or nil if none is recorded.
+*/
+- (NSString *)registeredPushIdHashForContainer:(id<HIDContainer>)container {
+    NSDictionary *hashes = [[NSUserDefaults standardUserDefaults] dictionaryForKey:PUSH_ID_HASHES_DEFAULTS_KEY];
+    return hashes[[self pushIdHashKeyForContainer:container]];
+}
+
+/**
+* This private method persists the hash of the Push ID registered for the container.
+*
+* @param pushIDHash - The hash to persist, or nil to forget the container so the next refresh resends the Push ID.
+* @param container - The container.
+*/
+- (void)setRegisteredPushIdHash:(NSString *)pushIDHash forContainer:(id<HIDContainer>)container {
+    NSUserDefaults *defaults = [NSUserDefaults standardUserDefaults];
+    @synchronized (defaults) {
+        NSMutableDictionary *hashes = [[defaults dictionaryForKey:PUSH_ID_HASHES_DEFAULTS_KEY] mutableCopy];
+        if (hashes == nil) {
+            hashes = [NSMutableDictionary dictionary];
+        }
+        NSString *key = [self pushIdHashKeyForContainer:container];
+        if (pushIDHash != nil) {
+            hashes[key] = pushIDHash;
+        } else {
+            [hashes removeObjectForKey:key];
+        }
+        [defaults setObject:hashes forKey:PUSH_ID_HASHES_DEFAULTS_KEY];
     }
 }
 
@@ -686,6 +2304,17 @@
             [self executeGenericCallback:(failure_CB) withParams:(@[@"Container Exception",@"Exception while fetching the container"])];
             return;
         }
+        bool isTOTPCached = self.isTOTPCacheEnabled && [otpKeyLabel isEqualToString:TOTP_OTP_KEY];
+        NSString* totpCacheKey = [NSString stringWithFormat:@"%ld|%@|%@|%lu", (long)[pContainer getId], [pContainer getUserId], otpKeyLabel, (unsigned long)self.credentialGeneration];
+        if(isTOTPCached){
+            uint64_t validUntil = 0;
+            NSString* cachedOTP = [self.totpCodeCache codeForKey:totpCacheKey validUntil:&validUntil];
+            if(cachedOTP != nil){
+                NSLog(@"ApproveSDKWrapper ---> HID:generateOTP Using cached TOTP valid until %llu", validUntil);
+                [self executeGenericCallback:(success_CB) withParams: (@[cachedOTP, @(validUntil * 1000)])];
+                return;
+            }
+        }
         NSMutableArray* filter = [[NSMutableArray alloc] init];
 //        [filter addObject:[HIDParameter parameterWithString:otpKeyLabel forKey:HID_KEY_PROPERTY_LABEL]];
         [filter addObject:[HIDParameter parameterWithString:HID_KEY_PROPERTY_USAGE_OTP forKey:HID_KEY_PROPERTY_USAGE]];
@@ -724,34 +2353,14 @@
         if(error != nil){
             NSLog(@"ApproveSDKWrapper ---> HID:generateOTP Exception in generateOTP %@",[error localizedDescription]);
             NSLog(@"ApproveSDKWrapper ---> HID:generateOTP Exception in generateOTP %d",(int)[error code]);
-            int errorCode = (int)[error code];
-            if(errorCode == 100){
-                NSLog(@"ApproveSDKWrapper ---> HID:generateOTP Authentiation Exception while generating OTP");
-                [self executeGenericCallback:(failure_CB) withParams:(@[AUTHENTICATION_EXCEPTION_NAME,[error localizedDescription]])];
-            }else if(errorCode == 204){
-                [self executeGenericCallback:(failure_CB) withParams:(@[FINGERPRINT_AUTH_REQUIRED_EXCEPTION_NAME,@(errorCode)])];
-            }else if(errorCode == 202){
-                [self executeGenericCallback:(failure_CB) withParams:(@[FINGERPRINT_NOT_ENROLLED_EXCEPTION_NAME,@(errorCode)])];
-            }else if(errorCode == 101){
-                [self executeGenericCallback:(failure_CB) withParams:(@[INVALID_PASSWORD_EXCEPTION_NAME,@(errorCode)])];
-            }else if(errorCode == 106){
-                [self executeGenericCallback:(failure_CB) withParams:(@[LOST_CREDENTIALS_EXCEPTION_NAME,@(errorCode)])];
-            }else if(errorCode == 105 || errorCode == 203){
-                NSLog(@"ApproveSDKWrapper ---> HID:generateOTP Biometric cancelled or wrong fingerprint entered");
-                [self executeGenericCallback:(failure_CB) withParams:(@[PASSWORD_REQUIRED_EXCEPTION_NAME,[error localizedDescription]])];
-            }else if (errorCode == 103){
-                [self executeGenericCallback:(failure_CB) withParams:(@[PASSWORD_EXPIRED_EXCEPTION_NAME,[error localizedDescription]])];
-            }else if(errorCode == 200){
-                [self executeGenericCallback:(failure_CB) withParams:(@[UNSUPPORTED_DEVICE_EXCEPTION_NAME,@(errorCode)])];
-            }else if(errorCode == 102){
-                [self executeGenericCallback:(failure_CB) withParams:(@[HID_CREDENTIALS_EXPIRED_EXCEPTION_NAME,@(errorCode)])];
-            }else if(errorCode == 0){
-                [self executeGenericCallback:(failure_CB) withParams:(@[INTERNAL_EXCEPTION_NAME,@(errorCode)])];
-            }else if(errorCode == 3){
-                [self executeGenericCallback:(failure_CB) withParams:(@[HID_INVALID_ARGUMENT_EXCEPTION_NAME,@(errorCode)])];
-            }else{
-                [self executeGenericCallback:(failure_CB) withParams:(@[@"OTPException",[error localizedDescription]])];
+            [self executeGenericCallback:(failure_CB) withParams:[self otpFailureParams:error]];
+        }else if(isTOTPCached){
+            uint64_t validUntil = [self endOfTOTPTimeStep:pOTPGenerator];
+            if(validUntil > 0){
+                [self.totpCodeCache storeCode:OTP forKey:totpCacheKey validUntil:validUntil];
             }
+            NSLog(@"ApproveSDKWrapper ---> HID:generateOTP Finished OTP generated, next code at %llu", validUntil);
+            [self executeGenericCallback:(success_CB) withParams: (@[OTP, @(validUntil * 1000)])];
         }else{
             NSLog(@"ApproveSDKWrapper ---> HID:generateOTP Finished OTP generated, OTP: %@",OTP);
             [self executeGenericCallback:(success_CB) withParams: (@[OTP])];
@@ -759,6 +2368,201 @@
     });
 }
 
+/**
+* This method maps an error raised while generating an OTP to the failure callback parameters.
+*
+* @param error - Error returned by getOTP.
+*
+* @return NSArray - Parameters for the failure callback.
+*/
+-(NSArray *)otpFailureParams:(NSError *)error {
+    int errorCode = (int)[error code];
+    if(errorCode == 100){
+        NSLog(@"ApproveSDKWrapper ---> HID:generateOTP Authentiation Exception while generating OTP");
+        return @[AUTHENTICATION_EXCEPTION_NAME,[error localizedDescription]];
+    }else if(errorCode == 204){
+        return @[FINGERPRINT_AUTH_REQUIRED_EXCEPTION_NAME,@(errorCode)];
+    }else if(errorCode == 202){
+        return @[FINGERPRINT_NOT_ENROLLED_EXCEPTION_NAME,@(errorCode)];
+    }else if(errorCode == 101){
+        return @[INVALID_PASSWORD_EXCEPTION_NAME,@(errorCode)];
+    }else if(errorCode == 106){
+        return @[LOST_CREDENTIALS_EXCEPTION_NAME,@(errorCode)];
+    }else if(errorCode == 105 || errorCode == 203){
+        NSLog(@"ApproveSDKWrapper ---> HID:generateOTP Biometric cancelled or wrong fingerprint entered");
+        return @[PASSWORD_REQUIRED_EXCEPTION_NAME,[error localizedDescription]];
+    }else if (errorCode == 103){
+        return @[PASSWORD_EXPIRED_EXCEPTION_NAME,[error localizedDescription]];
+    }else if(errorCode == 200){
+        return @[UNSUPPORTED_DEVICE_EXCEPTION_NAME,@(errorCode)];
+    }else if(errorCode == 102){
+        return @[HID_CREDENTIALS_EXPIRED_EXCEPTION_NAME,@(errorCode)];
+    }else if(errorCode == 0){
+        return @[INTERNAL_EXCEPTION_NAME,@(errorCode)];
+    }else if(errorCode == 3){
+        return @[HID_INVALID_ARGUMENT_EXCEPTION_NAME,@(errorCode)];
+    }
+    return @[@"OTPException",[error localizedDescription]];
+}
+
+/**
+* This method is used to generate the OTPs of several keys in one call.
+* The container and keys are resolved once and every label is validated before any OTP is generated. Each key is
+* unlocked by its own getOTP call: with a password that is the password entered once, with biometrics the SDK may
+* prompt for each key. The first failure stops the generation, so a failed or cancelled authentication is not
+* followed by prompts for the remaining labels.
+*
+* @param otpLabels - JSON array of OTP labels, "hotp" or "totp", e.g. ["hotp","totp"].
+* @param password - Password to be used for generating the OTPs. It can be "" if Biometrics are enabled
+* @param bioEnabled - Boolean to indicate if biometrics are enabled or not.
+* @param success_CB - Callback receiving a JSON object mapping each label to its OTP.
+* @param failure_CB - Callback to handle failure response.
+*/
+-(void)generateOTPs:(NSString *)otpLabels withPassword:(NSString *)password isBioEnabled:(bool)bioEnabled withSuccessCB:(JSValue *)success_CB failureCB:(JSValue *)failure_CB{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),^{
+        NSData* labelData = [otpLabels dataUsingEncoding:NSUTF8StringEncoding];
+        id labels = labelData != nil ? [NSJSONSerialization JSONObjectWithData:labelData options:0 error:nil] : nil;
+        if(![labels isKindOfClass:[NSArray class]] || [labels count] == 0){
+            NSLog(@"ApproveSDKWrapper ---> HID:generateOTPs Invalid OTP labels %@", otpLabels);
+            [self executeGenericCallback:(failure_CB) withParams:(@[INVALID_PARAMETER_EXCEPTION,INVALID_PARAMETER_CODE])];
+            return;
+        }
+        NSError* error;
+        id<HIDContainer> pContainer = [self getSingleUserContainer];
+        if(pContainer == nil){
+            NSLog(@"ApproveSDKWrapper ---> HID:generateOTPs No Containers Found");
+            [self executeGenericCallback:(failure_CB) withParams:(@[@"Container Exception",@"Exception while fetching the container"])];
+            return;
+        }
+        NSMutableArray* filter = [[NSMutableArray alloc] init];
+        [filter addObject:[HIDParameter parameterWithString:HID_KEY_PROPERTY_USAGE_OTP forKey:HID_KEY_PROPERTY_USAGE]];
+        NSArray* keys = [pContainer findKeys:filter error:&error];
+        if([keys count] == 0){
+            NSLog(@"ApproveSDKWrapper ---> HID:generateOTPs No OTP key found");
+            [self executeGenericCallback:(failure_CB) withParams:(@[@"No OTP Key Found",@"No OTP Key Found"])];
+            return;
+        }
+        NSMutableDictionary* keysByLabel = [NSMutableDictionary dictionaryWithCapacity:[keys count]];
+        for (id<HIDKey> key in keys) {
+            NSString *keyLabel = [key getProperty:HID_KEY_PROPERTY_LABEL error:nil];
+            if (keyLabel != nil) {
+                keysByLabel[keyLabel] = key;
+            }
+        }
+        NSMutableDictionary* otpKeyLabels = [NSMutableDictionary dictionaryWithCapacity:[labels count]];
+        for (id label in labels) {
+            NSString* otpKeyLabel = nil;
+            if([label isKindOfClass:[NSString class]] && [label isEqualToString:HOTP_LABEL_NAME]){
+                otpKeyLabel = HOTP_OTP_KEY;
+            }else if([label isKindOfClass:[NSString class]] && [label isEqualToString:TOTP_LABEL_NAME]){
+                otpKeyLabel = TOTP_OTP_KEY;
+            }
+            if(otpKeyLabel == nil){
+                NSLog(@"ApproveSDKWrapper ---> HID:generateOTPs Unknown OTP label %@", label);
+                [self executeGenericCallback:(failure_CB) withParams:(@[INVALID_PARAMETER_EXCEPTION,INVALID_PARAMETER_CODE])];
+                return;
+            }
+            if(keysByLabel[otpKeyLabel] == nil){
+                NSLog(@"ApproveSDKWrapper ---> HID:generateOTPs No OTP key found for %@", label);
+                [self executeGenericCallback:(failure_CB) withParams:(@[@"No OTP Key Found",@"No OTP Key Found"])];
+                return;
+            }
+            otpKeyLabels[label] = otpKeyLabel;
+        }
+        NSMutableDictionary* otps = [NSMutableDictionary dictionaryWithCapacity:[labels count]];
+        for (NSString* label in labels) {
+            if(otps[label] != nil){
+                continue;
+            }
+            NSString* otpKeyLabel = otpKeyLabels[label];
+            id<HIDKey> pKey = keysByLabel[otpKeyLabel];
+            bool isTOTPCached = self.isTOTPCacheEnabled && [otpKeyLabel isEqualToString:TOTP_OTP_KEY];
+            NSString* totpCacheKey = [NSString stringWithFormat:@"%ld|%@|%@|%lu", (long)[pContainer getId], [pContainer getUserId], otpKeyLabel, (unsigned long)self.credentialGeneration];
+            NSString* OTP = isTOTPCached ? [self.totpCodeCache codeForKey:totpCacheKey validUntil:NULL] : nil;
+            if(OTP == nil){
+                id<HIDOTPGenerator> pOTPGenerator = [pKey getDefaultOTPGenerator:(&error)];
+                OTP = [((id<HIDSyncOTPGenerator>) pOTPGenerator) getOTP:(bioEnabled ? nil : password) error:(&error)];
+                if(error != nil){
+                    NSLog(@"ApproveSDKWrapper ---> HID:generateOTPs Exception in generateOTP for %@ %@", label, [error localizedDescription]);
+                    [self executeGenericCallback:(failure_CB) withParams:[self otpFailureParams:error]];
+                    return;
+                }
+                uint64_t validUntil = isTOTPCached ? [self endOfTOTPTimeStep:pOTPGenerator] : 0;
+                if(validUntil > 0){
+                    [self.totpCodeCache storeCode:OTP forKey:totpCacheKey validUntil:validUntil];
+                }
+            }
+            otps[label] = OTP;
+        }
+        NSError *jsonError;
+        NSData *jsonData = [NSJSONSerialization dataWithJSONObject:otps options: NSJSONWritingPrettyPrinted error:&jsonError];
+        if(!jsonData){
+            NSLog(@"ApproveSDKWrapper ---> HID:generateOTPs Error while converting JSON %@", jsonError);
+            [self executeGenericCallback:(failure_CB) withParams:(@[@"JSONException",[jsonError localizedDescription]])];
+        }else{
+            NSLog(@"ApproveSDKWrapper ---> HID:generateOTPs Finished generating %lu OTPs", (unsigned long)[otps count]);
+            [self executeGenericCallback:(success_CB) withParams: (@[[[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding]])];
+        }
+    });
+}
+
+/**
+* This method computes when the current TOTP time step ends, i.e. when the next code becomes valid.
+*
+* @param pOTPGenerator - TOTP generator of the key.
+*
+* @return uint64_t - Unix time (seconds) of the end of the current time step, 0 if the generator is not time based.
+*/
+-(uint64_t)endOfTOTPTimeStep:(id<HIDOTPGenerator>)pOTPGenerator {
+    id<HIDAlgorithmParameters> parameters = [pOTPGenerator getAlgorithmParameters];
+    if(![(NSObject *)parameters conformsToProtocol:@protocol(HIDTOTPAlgorithmParameters)]){
+        return 0;
+    }
+    id<HIDTOTPAlgorithmParameters> totpParameters = (id<HIDTOTPAlgorithmParameters>)parameters;
+    uint64_t timeStep = [totpParameters getTimeStep];
+    uint64_t startTime = [totpParameters getStartTime];
+    uint64_t now = (uint64_t)[[NSDate date] timeIntervalSince1970];
+    if(timeStep == 0 || now < startTime){
+        return 0;
+    }
+    return startTime + ((now - startTime) / timeStep + 1) * timeStep;
+}
+
+/**
+* This method enables or disables caching of the current TOTP code until the end of its time step.
+* When enabled, the TOTP success callback receives the time (milliseconds since epoch) at which the next code becomes valid.
+*
+* @param enabled - true to enable the TOTP cache.
+*/
+-(void)setTOTPCacheEnabled:(bool)enabled {
+    self.isTOTPCacheEnabled = enabled;
+    if(!enabled){
+        [self.totpCodeCache invalidate];
+    }
+}
+
+/**
+* This method drops the caches derived from the user's credentials and starts a new container generation.
+* It is called whenever the credentials or the user change: create, renew, delete, password, biometrics and setUsername.
+*/
+-(void)invalidateCredentialCaches {
+    @synchronized ([HIDApproveSDKWrapper class]) {
+        sharedCredentialGeneration += 1;
+    }
+    [self.totpCodeCache invalidate];
+    [self.signatureChallengeCache removeAllObjects];
+    [self.signingSessions removeAllObjects];
+    @synchronized (self.dcsKeyHandles) {
+        self.containerGeneration += 1;
+        [self.dcsKeyHandles removeAllObjects];
+        self.directory = nil;
+        self.session = nil;
+    }
+    @synchronized (self.renewalSchedules) {
+        [self.renewalSchedules removeAllObjects];
+    }
+}
+
 /**
 * This method is used to get the Password/Pin Policy for the container.
 *
@@ -857,6 +2661,7 @@
             }
         }else{
             NSLog(@"ApproveSDKWrapper --> HID:updatePassword Password changed successfully");
+            [self invalidateCredentialCaches];
             [self executeGenericCallback:exceptionCallback withParams:(@[@"UpdatePassword",@"updateSuccess"])];
         }
     });
@@ -939,6 +2744,7 @@
         }
     }else{
         NSLog(@"ApproveSDKWrapper ---> HID:enableBiometrics Successfully Enabled Biometrics");
+        [self bioStateDidChange:pContainer state:[bioPasswordPolicy getBioAuthenticationState]];
         [self executeGenericCallback:(bioStatusCallback) withParams:(@[@TRUE,@"Success"])];
     }
 }
@@ -968,6 +2774,7 @@
     }else{
         NSLog(@"ApproveSDKWrapper ---> HID:disableBiometrics Successfully Disabled Biometrics");
     }
+    [self bioStateDidChange:pContainer state:[bioPasswordPolicy getBioAuthenticationState]];
 }
 
 /**
@@ -978,29 +2785,37 @@
 -(bool) checkBioAvailability{
     NSError *error;
     id<HIDContainer> pContainer = [self getSingleUserContainer];
-    id<HIDProtectionPolicy> policy = [pContainer getProtectionPolicy:(&error)];
-    if([policy policyType] != HIDPolicyTypeBioPassword){
+    NSNumber *bioState = [[self bioStateTable:nil] stateForContainer:pContainer];
+    if(bioState == nil){
+        id<HIDProtectionPolicy> policy = [self sessionProtectionPolicy:(&error)];
+        if([policy policyType] == HIDPolicyTypeBioPassword){
+            bioState = @([(id<HIDBioPasswordPolicy>)policy getBioAuthenticationState]);
+        }else{
+            bioState = @(BIO_STATE_NOT_SUPPORTED);
+        }
+    }
+    NSInteger state = [bioState integerValue];
+    if(state == BIO_STATE_NOT_SUPPORTED){
         NSLog(@"ApproveSDKWrapper ---> HID:checkBioAvailability Policy Does not support biometric");
         return FALSE;
     }
-    id<HIDBioPasswordPolicy> bioPasswordPolicy = (id<HIDBioPasswordPolicy>)policy;
-    if([bioPasswordPolicy getBioAuthenticationState] == HIDBioAuthenticationStateEnabled){
+    if(state == HIDBioAuthenticationStateEnabled){
         NSLog(@"ApproveSDKWrapper ---> HID:checkBioAvailability Bio Policy enabled");
         return TRUE;
     }
-    if([bioPasswordPolicy getBioAuthenticationState] == HIDBioAuthenticationStateNotEnabled){
+    if(state == HIDBioAuthenticationStateNotEnabled){
         NSLog(@"ApproveSDKWrapper ---> HID:checkBioAvailability Bio Policy Not enabled");
         return FALSE;
     }
-    if([bioPasswordPolicy getBioAuthenticationState] == HIDBioAuthenticationStateNotCapable){
+    if(state == HIDBioAuthenticationStateNotCapable){
         NSLog(@"ApproveSDKWrapper ---> HID:checkBioAvailability Bio Policy with the current device is not possible");
         return FALSE;
     }
-    if([bioPasswordPolicy getBioAuthenticationState] == HIDBioAuthenticationStateNotEnrolled){
+    if(state == HIDBioAuthenticationStateNotEnrolled){
         NSLog(@"ApproveSDKWrapper ---> HID:checkBioAvailability Biometric Feature in Device is not enrolled");
         return FALSE;
     }
-    if([bioPasswordPolicy getBioAuthenticationState] == HIDBioAuthenticationStateInvalidKey){
+    if(state == HIDBioAuthenticationStateInvalidKey){
         NSLog(@"ApproveSDKWrapper ---> HID:checkBioAvailability Bio Policy key has been invalidated");
         return FALSE;
     }
@@ -1055,33 +2870,11 @@
     NSLog(@"ApproveSDKWrapper ---> HID:signTransaction InsideSignTransaction");
     bool isBioEnabled = [self checkBioAvailability];
     id<HIDContainer> pContainer = [self getSingleUserContainer];
-    NSMutableArray* filter = [[NSMutableArray alloc] init];
-//    [filter addObject:[HIDParameter parameterWithString:otp_Key forKey:HID_KEY_PROPERTY_LABEL]];
-    [filter addObject:[HIDParameter parameterWithString:HID_KEY_PROPERTY_USAGE_OTP forKey:HID_KEY_PROPERTY_USAGE]];
-    NSArray* keys = [pContainer findKeys:filter error:&error];
-    
-    NSLog(@"ApproveSDKWrapper ---> HID:signTransaction Found Keys %@",keys);
-   
-    id<HIDKey> pKey = [keys objectAtIndex:0];
+    id<HIDKey> pKey = [self findOTPKey:pContainer withLabel:otp_Key];
     
     if (!pKey) {
         NSLog(@"ApproveSDKWrapper ---> HID:signTransaction No OTP key found");
         [self executeGenericCallback:(failureCB) withParams:(@[@"No OTP Key Found",@"No OTP Key Found"])];
-    }else{
-        if (keys.count > 1) {
-            NSLog(@"ApproveSDKWrapper ---> HID:signTransaction More than one OTP key found");
-            NSLog(@"ApproveSDKWrapper ---> HID:signTransaction More than one OTP key found");
-            for (id<HIDKey> key in keys) {
-                NSLog(@"ApproveSDKWrapper ---> HID:signTransaction - Key: %@", key);
-                NSLog(@"ApproveSDKWrapper ---> HID:signTransaction Checking key: %@", [key getProperty:HID_KEY_PROPERTY_LABEL error:nil]);
-                NSString *keyLabel = [key getProperty:HID_KEY_PROPERTY_LABEL error:nil];
-                if ([keyLabel isEqualToString:otp_Key] && keyLabel != nil) {
-                    pKey = key;
-                    NSLog(@"ApproveSDKWrapper ---> HID:signTransaction - Selected Key: %@", pKey);
-                    break;
-                }
-            }
-        }
     }
     
     NSString *lockPolicy = [self getLockPolicy:otp_Key withCode:CODE_SIGN ];
@@ -1089,8 +2882,8 @@
     
     
     id<HIDAsyncOTPGenerator> pAsyncAOTPGenerator = (id<HIDAsyncOTPGenerator>)[pKey getDefaultOTPGenerator:(&error)];
-    NSArray *tsDetails = [transactionDetails componentsSeparatedByString:(@"~")];
-    NSString *challenge = [pAsyncAOTPGenerator formatSignatureChallenge:(tsDetails) error:(&error)];
+    NSArray *tsDetails = [TransactionDetailsTokenizer fieldsFromString:transactionDetails separator:'~'];
+    NSString *challenge = [self signatureChallengeForKey:pKey withGenerator:pAsyncAOTPGenerator withFields:tsDetails error:&error];
     HIDOCRAInputAlgorithmParameters *inputParams = [[HIDOCRAInputAlgorithmParameters alloc] init];
     if(isBioEnabled){
         NSString *otp = [pAsyncAOTPGenerator computeSignature:(nil)
@@ -1139,6 +2932,156 @@
 });
 }
 
+/**
+* This method finds the OTP usage key with the given label, falling back to the first OTP key of the container.
+*
+* @param pContainer - Container holding the keys.
+* @param otpKeyLabel - The label of the key (e.g. OATH_event, OATH_OCRA_time_SIGN).
+*
+* @return id<HIDKey> - The matching key, nil if the container has no OTP key.
+*/
+-(id<HIDKey>)findOTPKey:(id<HIDContainer>)pContainer withLabel:(NSString *)otpKeyLabel{
+    NSError *error;
+    NSMutableArray* filter = [[NSMutableArray alloc] init];
+    [filter addObject:[HIDParameter parameterWithString:HID_KEY_PROPERTY_USAGE_OTP forKey:HID_KEY_PROPERTY_USAGE]];
+    NSArray* keys = [pContainer findKeys:filter error:&error];
+    NSLog(@"ApproveSDKWrapper ---> HID:findOTPKey Found Keys %@",keys);
+    if ([keys count] == 0) {
+        return nil;
+    }
+    for (id<HIDKey> key in keys) {
+        NSString *keyLabel = [key getProperty:HID_KEY_PROPERTY_LABEL error:nil];
+        if (keyLabel != nil && [keyLabel isEqualToString:otpKeyLabel]) {
+            NSLog(@"ApproveSDKWrapper ---> HID:findOTPKey - Selected Key: %@", key);
+            return key;
+        }
+    }
+    return [keys objectAtIndex:0];
+}
+
+/**
+* This method returns the OCRA signature challenge for the transaction fields, formatting it only once per key and fields.
+*
+* @param pKey - Signature key.
+* @param pAsyncOTPGenerator - The asynchronous OTP generator of the key.
+* @param tsDetails - Transaction detail fields.
+* @param error - Set when the challenge could not be formatted.
+*
+* @return NSString - The formatted signature challenge.
+*/
+-(NSString *)signatureChallengeForKey:(id<HIDKey>)pKey withGenerator:(id<HIDAsyncOTPGenerator>)pAsyncOTPGenerator withFields:(NSArray *)tsDetails error:(NSError **)error{
+    // Length-prefixed so that no two field lists share a cache key
+    NSMutableString *cacheKey = [NSMutableString stringWithFormat:@"%@", [[pKey getId] ID]];
+    for (NSString *field in tsDetails) {
+        [cacheKey appendFormat:@"|%lu:%@", (unsigned long)[field length], field];
+    }
+    NSString *challenge = [self.signatureChallengeCache objectForKey:cacheKey];
+    if (challenge != nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:signatureChallengeForKey Using cached challenge");
+        return challenge;
+    }
+    challenge = [pAsyncOTPGenerator formatSignatureChallenge:(tsDetails) error:error];
+    if (challenge != nil) {
+        [self.signatureChallengeCache setObject:challenge forKey:cacheKey expiryDate:[NSDate dateWithTimeIntervalSinceNow:SIGNATURE_CHALLENGE_CACHE_TTL_SECONDS]];
+    }
+    return challenge;
+}
+
+/**
+* This method formats the signature challenge of the transaction details in the background, typically when the
+* details are first displayed, so that the following signTransaction goes straight to computing the signature.
+*
+* @param transactionDetails - Details of the transaction to be signed.
+* @param otpLabel - The label for the signature key, can be TOTP or HOTP.
+*/
+-(void)prepareSignatureChallenge:(NSString *)transactionDetails withOTPLabel:(NSString *)otpLabel{
+    NSString * otp_key = [otpLabel isEqualToString: TOTP_LABEL_NAME] ? TOTP_SIGN_KEY : HOTP_SIGN_KEY;
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0),^{
+        NSError *error;
+        id<HIDKey> pKey = [self findOTPKey:[self getSingleUserContainer] withLabel:otp_key];
+        id<HIDAsyncOTPGenerator> pAsyncAOTPGenerator = (id<HIDAsyncOTPGenerator>)[pKey getDefaultOTPGenerator:(&error)];
+        if (pAsyncAOTPGenerator == nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:prepareSignatureChallenge No signature key found");
+            return;
+        }
+        NSArray *tsDetails = [TransactionDetailsTokenizer fieldsFromString:transactionDetails separator:'~'];
+        [self signatureChallengeForKey:pKey withGenerator:pAsyncAOTPGenerator withFields:tsDetails error:&error];
+        if (error != nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:prepareSignatureChallenge Error while formatting challenge %@", [error localizedDescription]);
+        }
+    });
+}
+
+/**
+* This method resolves everything needed to sign a transaction (container, key, biometric state and signature
+* challenge) in the background, before the user approves. The returned session handle is then passed to
+* commitSignTransaction, which only computes the signature.
+*
+* @param transactionDetails - Details of the transaction to be signed.
+* @param otpLabel - The label for the signature key, can be TOTP or HOTP.
+* @param callback - Callback receiving ("success", sessionHandle, isBioEnabled) or ("failure", exceptionName, message).
+*/
+-(void)prepareSignTransaction:(NSString *)transactionDetails withOTPLabel:(NSString *)otpLabel withCallback:(JSValue *)callback{
+    NSString * otp_key = [otpLabel isEqualToString: TOTP_LABEL_NAME] ? TOTP_SIGN_KEY : HOTP_SIGN_KEY;
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),^{
+        NSError *error;
+        bool isBioEnabled = [self checkBioAvailability];
+        id<HIDKey> pKey = [self findOTPKey:[self getSingleUserContainer] withLabel:otp_key];
+        if (!pKey) {
+            NSLog(@"ApproveSDKWrapper ---> HID:prepareSignTransaction No OTP key found");
+            [self executeGenericCallback:(callback) withParams:(@[@"failure",@"No OTP Key Found",@"No OTP Key Found"])];
+            return;
+        }
+        id<HIDAsyncOTPGenerator> pAsyncAOTPGenerator = (id<HIDAsyncOTPGenerator>)[pKey getDefaultOTPGenerator:(&error)];
+        NSArray *tsDetails = [TransactionDetailsTokenizer fieldsFromString:transactionDetails separator:'~'];
+        NSString *challenge = [self signatureChallengeForKey:pKey withGenerator:pAsyncAOTPGenerator withFields:tsDetails error:&error];
+        if (challenge == nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:prepareSignTransaction Error while formatting challenge %@", [error localizedDescription]);
+            [self executeGenericCallback:(callback) withParams:(@[@"failure",@"signTSError",([error localizedDescription] != nil ? [error localizedDescription] : @"")])];
+            return;
+        }
+        SigningSession *session = [[SigningSession alloc] init];
+        session.generator = pAsyncAOTPGenerator;
+        session.challenge = challenge;
+        NSString *sessionHandle = [[NSUUID UUID] UUIDString];
+        [self.signingSessions setObject:session forKey:sessionHandle expiryDate:[NSDate dateWithTimeIntervalSinceNow:SIGNATURE_CHALLENGE_CACHE_TTL_SECONDS]];
+        NSLog(@"ApproveSDKWrapper ---> HID:prepareSignTransaction Prepared signing session %@", sessionHandle);
+        [self executeGenericCallback:(callback) withParams:(@[@"success",sessionHandle,isBioEnabled?@"true":@"false"])];
+    });
+}
+
+/**
+* This method signs the transaction prepared by prepareSignTransaction. Only the signature computation is performed.
+* The session is kept after an authentication failure so the caller can retry with another password.
+*
+* @param sessionHandle - Handle returned by prepareSignTransaction.
+* @param password - Password to be used for signing. It can be "" if Biometrics are enabled
+* @param isBioEnabled - Boolean to indicate if biometrics are to be used.
+* @param successCB - Callback function for successful response.
+* @param failureCB - Callback function for failed response.
+*/
+-(void)commitSignTransaction:(NSString *)sessionHandle withPassword:(NSString *)password isBioEnabled:(bool)isBioEnabled withSuccessCB:(JSValue *)successCB withFailureCB:(JSValue *)failureCB{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),^{
+        SigningSession *session = [self.signingSessions objectForKey:sessionHandle];
+        if (session == nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:commitSignTransaction Unknown or expired signing session %@", sessionHandle);
+            [self executeGenericCallback:(failureCB) withParams:(@[INVALID_PARAMETER_EXCEPTION,INVALID_PARAMETER_CODE])];
+            return;
+        }
+        NSError *error;
+        HIDOCRAInputAlgorithmParameters *inputParams = [[HIDOCRAInputAlgorithmParameters alloc] init];
+        NSString *otp = [session.generator computeSignature:(isBioEnabled ? nil : password)
+                                           withSigChallenge:(session.challenge) withClientChallenge:(nil) withInputParams:(inputParams) error:(&error)];
+        if (error != nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:commitSignTransaction Exception occured while signTs %@", [error localizedDescription]);
+            [self executeGenericCallback:(failureCB) withParams:(@[@"signTSError",([error localizedDescription] != nil ? [error localizedDescription] : @"")])];
+        } else {
+            [self.signingSessions removeObjectForKey:sessionHandle];
+            [self executeGenericCallback:(successCB) withParams:(@[otp])];
+        }
+    });
+}
+
 /**
 *
 *This method is used to get the Password for the Transaction Sign flow.
@@ -1212,29 +3155,174 @@
                          withFailureCB:(failureCB)
                        withPwdPromptCB:(pwdPromptCB)];
         }
-        else{
-            NSLog(@"ApproveSDKWrapper ---> HID:invokeTsPasswordAuth Exception occured while signTs %@", [error localizedDescription]);
-            [self executeGenericCallback:(failureCB) withParams:(@[@"signTSError",[error localizedDescription]])];
+        else{
+            NSLog(@"ApproveSDKWrapper ---> HID:invokeTsPasswordAuth Exception occured while signTs %@", [error localizedDescription]);
+            [self executeGenericCallback:(failureCB) withParams:(@[@"signTSError",[error localizedDescription]])];
+        }
+    }else{
+        //NSLog(@"ApproveSDKWrapper ---> Secure Code Generated is %@", otp);
+        self.tsGroup = nil;
+        [self executeGenericCallback:(successCB) withParams:(@[otp])];
+    }
+}
+
+/**
+* This method notifies the password to the monitor based (for Sign Transaction) on the mode.
+*
+* @param password - The password to notify.
+* @param mode - The mode of operation - SIGN_TRANSACTION_FLOW
+*/
+-(void)notifyPassword:(NSString *)password withMode:(NSString *)mode{
+    NSLog(@"ApproveSDKWrapper ---> HID:notifyPassword notifyPassword called with mode %@", mode);
+    if([mode isEqualToString:(SIGN_TRANSACTION_FLOW)]){
+        self.tsMonitorObj = password;
+        dispatch_group_leave(self.tsGroup);
+    }
+}
+
+/**
+* This private method returns the container directory, reading the containers from the SDK only when the container
+* generation changed since it was built.
+*
+* @param error - On failure, the device or container error.
+*
+* @return ContainerDirectory - The directory, or nil on failure.
+*/
+- (ContainerDirectory *)containerDirectory:(NSError **)error {
+    ContainerDirectory *directory = self.directory;
+    NSUInteger generation = self.containerGeneration;
+    if (directory != nil && directory.generation == generation) {
+        return directory;
+    }
+    NSError *containerError = nil;
+    id<HIDDevice> pDevice = [self getDevice:&containerError];
+    NSArray *pContainers = pDevice != nil ? [pDevice findContainers:[[NSMutableArray alloc] init] error:&containerError] : nil;
+    if (containerError != nil) {
+        if (error) {
+            *error = containerError;
+        }
+        return nil;
+    }
+    directory = [[ContainerDirectory alloc] initWithContainers:pContainers generation:generation];
+    [self cacheContainerDirectory:directory];
+    return directory;
+}
+
+/**
+* This private method keeps a directory built from freshly read containers, unless the containers changed meanwhile.
+*
+* @param directory - The directory.
+*/
+- (void)cacheContainerDirectory:(ContainerDirectory *)directory {
+    @synchronized (self.dcsKeyHandles) {
+        if (directory.generation == self.containerGeneration) {
+            self.directory = directory;
+        }
+    }
+}
+
+/**
+* This private method returns the biometric state table, reading the protection policies once. Enabling or disabling
+* biometrics through this wrapper updates it in place and leaves the container generation alone.
+* It is rebuilt when containers are added or removed, when biometrics change through another wrapper or session, and
+* when the app returns to the foreground.
+*
+* @param error - On failure, the device or container error.
+*
+* @return BioStateTable - The table, or nil on failure.
+*/
+- (BioStateTable *)bioStateTable:(NSError **)error {
+    [self syncContainerGeneration];
+    BioStateTable *bioStates = self.bioStates;
+    NSUInteger stateGeneration = self.bioStateGeneration;
+    if (bioStates != nil && bioStates.generation == self.containerGeneration && bioStates.stateGeneration == stateGeneration) {
+        return bioStates;
+    }
+    ContainerDirectory *directory = [self containerDirectory:error];
+    if (directory == nil) {
+        return nil;
+    }
+    bioStates = [[BioStateTable alloc] initWithEntries:directory.entries generation:directory.generation];
+    bioStates.stateGeneration = stateGeneration;
+    @synchronized (self.dcsKeyHandles) {
+        if (bioStates.generation == self.containerGeneration) {
+            self.bioStates = bioStates;
+        }
+    }
+    return bioStates;
+}
+
+/**
+* This private method records the biometric state of a container after biometrics were enabled or disabled.
+*
+* @param pContainer - The container.
+* @param state - The biometric authentication state read after the change.
+*/
+- (void)bioStateDidChange:(id<HIDContainer>)pContainer state:(HIDBioAuthenticationState)state {
+    BioStateTable *bioStates = self.bioStates;
+    [bioStates setState:state forContainer:pContainer];
+    // Other wrappers and sessions rebuild their tables, this one stays current unless it was already stale
+    @synchronized ([HIDApproveSDKWrapper class]) {
+        if (bioStates != nil && bioStates.stateGeneration == sharedBioStateGeneration) {
+            bioStates.stateGeneration = sharedBioStateGeneration + 1;
+        }
+        sharedBioStateGeneration += 1;
+    }
+    [self scheduleLoginFlowSnapshotRefresh];
+}
+
+/**
+* This private method drops the biometric state table, since biometrics may have been enrolled or removed in the
+* device settings while the app was in the background, and rebuilds it off the main thread.
+* Starting a new biometric state generation also makes the sessions, which have no foreground observer, rebuild theirs.
+*/
+- (void)revalidateBioStates {
+    @synchronized ([HIDApproveSDKWrapper class]) {
+        sharedBioStateGeneration += 1;
+    }
+    @synchronized (self.dcsKeyHandles) {
+        if (self.bioStates == nil) {
+            return;
         }
-    }else{
-        //NSLog(@"ApproveSDKWrapper ---> Secure Code Generated is %@", otp);
-        self.tsGroup = nil;
-        [self executeGenericCallback:(successCB) withParams:(@[otp])];
+        self.bioStates = nil;
     }
+    NSLog(@"ApproveSDKWrapper ---> HID:revalidateBioStates Revalidating biometric states");
+    __weak HIDApproveSDKWrapper *weakSelf = self;
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        [weakSelf bioStateTable:nil];
+    });
 }
 
 /**
-* This method notifies the password to the monitor based (for Sign Transaction) on the mode.
+* This method lists the containers of the device sorted by userId, answered from the container directory.
 *
-* @param password - The password to notify.
-* @param mode - The mode of operation - SIGN_TRANSACTION_FLOW
+* @return NSString - A JSON array of {userId, containerId, friendlyName, isBioEnabled}, or "error".
 */
--(void)notifyPassword:(NSString *)password withMode:(NSString *)mode{
-    NSLog(@"ApproveSDKWrapper ---> HID:notifyPassword notifyPassword called with mode %@", mode);
-    if([mode isEqualToString:(SIGN_TRANSACTION_FLOW)]){
-        self.tsMonitorObj = password;
-        dispatch_group_leave(self.tsGroup);
+-(NSString *)getContainerDirectory{
+    NSError *error = nil;
+    ContainerDirectory *directory = [self containerDirectory:&error];
+    if (directory == nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:getContainerDirectory error while fetching containers %@", [error localizedDescription]);
+        return @"error";
     }
+    [directory entriesWithFriendlyNames];
+    BioStateTable *bioStates = [self bioStateTable:nil];
+    NSMutableArray *containers = [NSMutableArray arrayWithCapacity:[directory.entries count]];
+    for (ContainerDirectoryEntry *entry in [directory sortedEntries]) {
+        NSMutableDictionary *containerInfo = [NSMutableDictionary dictionary];
+        containerInfo[@"userId"] = entry.userId;
+        containerInfo[@"containerId"] = [NSString stringWithFormat:@"%ld", (long)[entry.container getId]];
+        containerInfo[@"friendlyName"] = entry.friendlyName;
+        NSNumber *bioState = [bioStates stateForContainer:entry.container];
+        containerInfo[@"isBioEnabled"] = bioState != nil && [bioState integerValue] == HIDBioAuthenticationStateEnabled ? @"true" : @"false";
+        [containers addObject:containerInfo];
+    }
+    NSData *jsonData = [NSJSONSerialization dataWithJSONObject:containers options:NSJSONWritingPrettyPrinted error:&error];
+    if (!jsonData) {
+        NSLog(@"ApproveSDKWrapper ---> HID:getContainerDirectory JSON Error: %@", error.localizedDescription);
+        return @"error";
+    }
+    return [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
 }
 
 /**
@@ -1244,14 +3332,20 @@
 */
 -(id<HIDContainer>)getSingleUserContainer{
     //  NSLog(@"ApproveSDKWrapper ---> getSingleUserContainer called from Wrapper Framework");
+    [self syncContainerGeneration];
+    NSString *username = _username;
+    NSUInteger generation = self.containerGeneration;
+    UserSession *session = self.session;
+    if (session != nil && session.generation == generation && (session.userId == username || [session.userId isEqualToString:username])) {
+        return session.container;
+    }
     NSError* deviceError;
     NSError* containerError;
-    HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-    id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+    id<HIDDevice> pDevice = [self getDevice:&deviceError];
     NSMutableArray* filterContainers = [[NSMutableArray alloc]init];
-    if(_username != nil){
-        NSLog(@"ApproveSDKWrapper ---> HID:getSingleUserContainer Username is %@", _username);
-        [filterContainers addObject:[HIDParameter parameterWithString: (_username) forKey:HID_CONTAINER_USERID]];
+    if(username != nil){
+        NSLog(@"ApproveSDKWrapper ---> HID:getSingleUserContainer Username is %@", username);
+        [filterContainers addObject:[HIDParameter parameterWithString: (username) forKey:HID_CONTAINER_USERID]];
     }
     NSArray* pConatiners  = [pDevice findContainers:filterContainers error:&containerError];
     if ([pConatiners count] == 0) {
@@ -1264,7 +3358,14 @@
         NSLog(@"ApproveSDKWrapper ---> HID:getSingleUserContainer error while creating container %@", [containerError localizedDescription]);
         return nil;
     }
-    return [pConatiners objectAtIndex:(0)];
+    id<HIDContainer> pContainer = [pConatiners objectAtIndex:(0)];
+    @synchronized (self.dcsKeyHandles) {
+        // A container resolved before a create/renew/delete is not kept
+        if (generation == self.containerGeneration) {
+            self.session = [[UserSession alloc] initWithUserId:username container:pContainer generation:generation];
+        }
+    }
+    return pContainer;
 }
 
 /**
@@ -1276,8 +3377,7 @@
     id<HIDContainer> pContainer = [self getSingleUserContainer];
     NSError* deviceError;
     NSError* error;
-    HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-    id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+    id<HIDDevice> pDevice = [self getDevice:&deviceError];
     if(pContainer == nil){
         NSLog(@"ApproveSDKWrapper ---> HID:deleteContainer Containers not found while deleting");
         return FALSE;
@@ -1317,6 +3417,10 @@
             return FALSE;
         }
     }
+    //Forget the Push ID so a container reusing this id and user registers it again
+    [self setRegisteredPushIdHash:nil forContainer:pContainer];
+    [self invalidateCredentialCaches];
+    [self containersDidChange];
     return TRUE;
 }
 
@@ -1330,8 +3434,7 @@
     id<HIDContainer> pContainer = [self getSingleUserContainer];
     NSError* deviceError;
     NSError* error;
-    HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-    id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+    id<HIDDevice> pDevice = [self getDevice:&deviceError];
     if(pContainer == nil){
         NSLog(@"ApproveSDKWrapper ---> HID:deleteContainerWithReason Containers not found while deleting");
         return FALSE;
@@ -1376,9 +3479,63 @@
             return FALSE;
         }
     }
+    //Forget the Push ID so a container reusing this id and user registers it again
+    [self setRegisteredPushIdHash:nil forContainer:pContainer];
+    [self invalidateCredentialCaches];
+    [self containersDidChange];
     return TRUE;
 }
 
+/**
+* This method retrieves the pending transaction IDs of the container, reporting any error through the callback.
+*
+* @param pContainer - Container to retrieve the pending transaction IDs for.
+* @param callback - Callback function invoked with the failure details on error.
+*
+* @return NSArray - Pending transaction IDs, or nil when an error was reported.
+*/
+-(NSArray *)retrievePendingTransactionIds:(id<HIDContainer>)pContainer withCallback:(JSValue *)callback{
+    NSError* error;
+    NSArray* txIDArray = [pContainer retrieveTransactionIds:nil withParams:nil error:&error];
+    if(error != nil){
+        int errorCode = (int)[error code];
+        if (errorCode == 100){
+            NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Authentication Exception %@",[error localizedDescription]);
+            [self executeGenericCallback:callback withParams:@[@"failure", AUTHENTICATION_EXCEPTION_NAME, @(errorCode)]];
+            return nil;
+        }else if (errorCode == 1000){
+            NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Transaction Expired Exception %@",[error localizedDescription]);
+            [self executeGenericCallback:callback withParams:@[@"failure", TRANSACTION_EXPIRED_EXCEPTION_NAME, @(errorCode)]];
+            return nil;
+        }else if (errorCode == 102){
+            NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Credentials Expired Exception %@",[error localizedDescription]);
+            [self executeGenericCallback:callback withParams:@[@"failure", HID_CREDENTIALS_EXPIRED_EXCEPTION_NAME, @(errorCode)]];
+            return nil;
+        }else if (errorCode == 0){
+            NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Internal Exception %@",[error localizedDescription]);
+            [self executeGenericCallback:callback withParams:@[@"failure", INTERNAL_EXCEPTION_NAME, @(errorCode)]];
+            return nil;
+        }else if (errorCode == 103){
+            NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Password Expired Exception %@",[error localizedDescription]);
+            [self executeGenericCallback:callback withParams:@[@"failure", PASSWORD_EXPIRED_EXCEPTION_NAME, @(errorCode)]];
+            return nil;
+        }else if (errorCode == 300){
+            NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Server Authentication Exception %@",[error localizedDescription]);
+            [self executeGenericCallback:callback withParams:@[@"failure", SERVER_AUTH_EXCEPTION_NAME, @(errorCode)]];
+            return nil;
+        }else if (errorCode == 3){
+            NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Invalid Argument Exception %@",[error localizedDescription]);
+            [self executeGenericCallback:callback withParams:@[@"failure", HID_INVALID_ARGUMENT_EXCEPTION_NAME, @(errorCode)]];
+            return nil;
+        }else{
+            NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications %@",[error localizedDescription]);
+            [self executeGenericCallback:callback withParams:@[@"failure", [error localizedDescription]]];
+            return nil;
+        }
+    }
+    return txIDArray != nil ? txIDArray : @[];
+}
+
 /**
 * This method retrieves pending notifications.
 *
@@ -1387,43 +3544,9 @@
 -(void) retrievePendingNotifications:(JSValue *)callback{
     dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),^{
         id<HIDContainer> pContainer = [self getSingleUserContainer];
-        NSError* error;
-        NSArray* txIDArray = [pContainer retrieveTransactionIds:nil withParams:nil error:&error];
-        if(error != nil){
-            int errorCode = (int)[error code];
-            if (errorCode == 100){
-                NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Authentication Exception %@",[error localizedDescription]);
-                [self executeGenericCallback:callback withParams:@[@"failure", AUTHENTICATION_EXCEPTION_NAME, @(errorCode)]];
-                return;
-            }else if (errorCode == 1000){
-                NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Transaction Expired Exception %@",[error localizedDescription]);
-                [self executeGenericCallback:callback withParams:@[@"failure", TRANSACTION_EXPIRED_EXCEPTION_NAME, @(errorCode)]];
-                return;
-            }else if (errorCode == 102){
-                NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Credentials Expired Exception %@",[error localizedDescription]);
-                [self executeGenericCallback:callback withParams:@[@"failure", HID_CREDENTIALS_EXPIRED_EXCEPTION_NAME, @(errorCode)]];
-                return;
-            }else if (errorCode == 0){
-                NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Internal Exception %@",[error localizedDescription]);
-                [self executeGenericCallback:callback withParams:@[@"failure", INTERNAL_EXCEPTION_NAME, @(errorCode)]];
-                return;
-            }else if (errorCode == 103){
-                NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Password Expired Exception %@",[error localizedDescription]);
-                [self executeGenericCallback:callback withParams:@[@"failure", PASSWORD_EXPIRED_EXCEPTION_NAME, @(errorCode)]];
-                return;
-            }else if (errorCode == 300){
-                NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Server Authentication Exception %@",[error localizedDescription]);
-                [self executeGenericCallback:callback withParams:@[@"failure", SERVER_AUTH_EXCEPTION_NAME, @(errorCode)]];
-                return;
-            }else if (errorCode == 3){
-                NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications Invalid Argument Exception %@",[error localizedDescription]);
-                [self executeGenericCallback:callback withParams:@[@"failure", HID_INVALID_ARGUMENT_EXCEPTION_NAME, @(errorCode)]];
-                return;
-            }else{
-                NSLog(@"ApproveSDKWrapper ----> HID:retrievePendingNotifications Error while Retrieveing Notifications %@",[error localizedDescription]);
-                [self executeGenericCallback:callback withParams:@[@"failure", [error localizedDescription]]];
-                return;
-            }
+        NSArray* txIDArray = [self retrievePendingTransactionIds:pContainer withCallback:callback];
+        if(txIDArray == nil){
+            return;
         }
         if([txIDArray count] == 0){
             [self executeGenericCallback:callback withParams:@[@"failure", @"{}"]];
@@ -1449,6 +3572,199 @@
     });
 }
 
+/**
+* This method retrieves the changes to the pending notifications since the given sync token.
+* The wrapper keeps the last reported set of transaction IDs per container; when the sync token does not match
+* the last one issued for the container (e.g. "" on first use), all pending IDs are reported as added with reset set to true.
+*
+* @param syncToken - Sync token returned by the previous call, pass "" to resynchronize.
+* @param callback - The callback function to execute with the compact {added, removed, syncToken, reset} JSON.
+*/
+-(void) retrievePendingNotificationsDelta:(NSString *)syncToken withCallback:(JSValue *)callback{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),^{
+        id<HIDContainer> pContainer = [self getSingleUserContainer];
+        NSArray* txIDArray = [self retrievePendingTransactionIds:pContainer withCallback:callback];
+        if(txIDArray == nil){
+            return;
+        }
+        NSSet<NSString *>* currentIDs = [NSSet setWithArray:txIDArray];
+        NSArray* added;
+        NSArray* removed;
+        bool isReset;
+        unsigned long long newSyncToken;
+        @synchronized (self.pendingSyncStates) {
+            NSNumber* containerKey = @([pContainer getId]);
+            PendingTransactionSyncState* state = self.pendingSyncStates[containerKey];
+            isReset = state == nil || ![[NSString stringWithFormat:@"%llu", state.syncToken] isEqualToString:syncToken];
+            if(isReset){
+                added = txIDArray;
+                removed = @[];
+            }else{
+                NSMutableArray* addedIDs = [NSMutableArray array];
+                for(NSString* txID in txIDArray){
+                    if(![state.txIDs containsObject:txID]){
+                        [addedIDs addObject:txID];
+                    }
+                }
+                NSMutableArray* removedIDs = [NSMutableArray array];
+                for(NSString* txID in state.txIDs){
+                    if(![currentIDs containsObject:txID]){
+                        [removedIDs addObject:txID];
+                    }
+                }
+                added = addedIDs;
+                removed = removedIDs;
+            }
+            if(state == nil){
+                state = [[PendingTransactionSyncState alloc] init];
+                self.pendingSyncStates[containerKey] = state;
+            }
+            if(isReset || [added count] > 0 || [removed count] > 0){
+                self.lastSyncToken += 1;
+                state.syncToken = self.lastSyncToken;
+                state.txIDs = currentIDs;
+            }
+            newSyncToken = state.syncToken;
+        }
+        NSDictionary* jsonObj = [NSDictionary dictionaryWithObjectsAndKeys:added, @"added", removed, @"removed",
+                                 [NSString stringWithFormat:@"%llu", newSyncToken], @"syncToken", @(isReset), @"reset", nil];
+        NSError *jsonError;
+        NSData *jsonData = [NSJSONSerialization dataWithJSONObject:jsonObj options:0 error:&jsonError];
+        if(!jsonData){
+            NSLog(@"ApproveSDKWrapper ---> HID:retrievePendingNotificationsDelta Error while converting JSON %@", jsonError);
+            [self executeGenericCallback:callback withParams:@[@"failure", [jsonError localizedDescription]]];
+        }else{
+            NSString *jsonString = [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
+            NSLog(@"ApproveSDKWrapper ---> HID:retrievePendingNotificationsDelta Delta is %@", jsonString);
+            [self executeGenericCallback:callback withParams:(@[@"success",jsonString])];
+        }
+    });
+}
+
+/**
+* This method retrieves the pending notifications together with their transaction details.
+* The transactions are fetched in parallel with bounded concurrency and cached for the following approve/deny.
+*
+* @param callback - The callback function to execute with the aggregated result, in pending notification order.
+*                   Each item carries either the transaction details or the exception that prevented retrieving it.
+*/
+-(void) retrievePendingTransactions:(JSValue *)callback{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),^{
+        id<HIDContainer> pContainer = [self getSingleUserContainer];
+        NSArray* txIDArray = [self retrievePendingTransactionIds:pContainer withCallback:callback];
+        if(txIDArray == nil){
+            return;
+        }
+        if([txIDArray count] == 0){
+            [self executeGenericCallback:callback withParams:@[@"failure", @"{}"]];
+            return;
+        }
+        NSError* deviceError;
+        id<HIDDevice> pDevice = [self getDevice:&deviceError];
+        if(deviceError != nil){
+            int errorCodeDevice = (int)[deviceError code];
+            NSLog(@"ApproveSDKWrapper ---> HID:retrievePendingTransactions Error while creating HID Device %@", [deviceError localizedDescription]);
+            [self executeGenericCallback:callback withParams:@[@"failure", [self transactionExceptionName:errorCodeDevice], @(errorCodeDevice)]];
+            return;
+        }
+        NSUInteger count = [txIDArray count];
+        // Keep every transaction of the batch warm for the following approve/deny
+        [self.transactionCache ensureCapacity:count];
+        NSMutableArray* results = [NSMutableArray arrayWithCapacity:count];
+        for(NSUInteger i = 0; i < count; i++){
+            [results addObject:[NSNull null]];
+        }
+        dispatch_group_t fetchGroup = dispatch_group_create();
+        dispatch_semaphore_t fetchSlots = dispatch_semaphore_create(PENDING_TRANSACTION_FETCH_CONCURRENCY);
+        for(NSUInteger i = 0; i < count; i++){
+            NSString* txID = [txIDArray objectAtIndex:i];
+            dispatch_semaphore_wait(fetchSlots, DISPATCH_TIME_FOREVER);
+            dispatch_group_async(fetchGroup, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+                NSError* error;
+                TransactionCacheEntry *transactionEntry = [self retrieveTransactionEntry:txID fromDevice:pDevice error:&error];
+                NSDictionary* item;
+                if(transactionEntry == nil){
+                    int errorCode = (int)[error code];
+                    NSLog(@"ApproveSDKWrapper ---> HID:retrievePendingTransactions Error while retreiving transaction %@ %@", txID, [error localizedDescription]);
+                    item = [NSDictionary dictionaryWithObjectsAndKeys:txID, @"txID", @"failure", @"status",
+                            [self transactionExceptionName:errorCode], @"exception", @(errorCode), @"code", nil];
+                }else{
+                    NSString* tds = transactionEntry.transactionString;
+                    NSString* username = [transactionEntry.container getUserId];
+                    item = [NSDictionary dictionaryWithObjectsAndKeys:txID, @"txID", @"success", @"status",
+                            tds ? tds : @"", @"tds", username ? username : @"", @"username", nil];
+                }
+                @synchronized (results) {
+                    [results replaceObjectAtIndex:i withObject:item];
+                }
+                dispatch_semaphore_signal(fetchSlots);
+            });
+        }
+        dispatch_group_wait(fetchGroup, DISPATCH_TIME_FOREVER);
+        NSDictionary* jsonObj = [NSDictionary dictionaryWithObjectsAndKeys:results, @"transactions", nil];
+        NSError *jsonError;
+        NSData *jsonData = [NSJSONSerialization dataWithJSONObject:jsonObj options: NSJSONWritingPrettyPrinted error:&jsonError];
+        if(!jsonData){
+            NSLog(@"ApproveSDKWrapper ---> HID:retrievePendingTransactions Error while converting JSON %@", jsonError);
+            [self executeGenericCallback:callback withParams:@[@"failure", [jsonError localizedDescription]]];
+        }else{
+            NSString *jsonString = [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
+            NSLog(@"ApproveSDKWrapper ---> HID:retrievePendingTransactions Retrieved %lu transactions", (unsigned long)count);
+            [self executeGenericCallback:callback withParams:(@[@"success",jsonString])];
+        }
+    });
+}
+
+/**
+* This method maps an SDK error code raised while retrieving or updating a transaction to the exception name reported to JS.
+*
+* @param errorCode - SDK error code.
+*
+* @return NSString - Exception name.
+*/
+-(NSString *)transactionExceptionName:(int)errorCode{
+    if(errorCode == 0){
+        return INTERNAL_EXCEPTION_NAME;
+    }else if(errorCode == 3){
+        return HID_INVALID_ARGUMENT_EXCEPTION_NAME;
+    }else if(errorCode == 7){
+        return HID_UNSUPPORTED_VERSION_EXCEPTION_NAME;
+    }else if(errorCode == 8){
+        return HID_INVALID_CONTAINER_EXCEPTION_NAME;
+    }else if(errorCode == 9){
+        return HID_INEXPLICIT_CONTAINER_EXCEPTION_NAME;
+    }else if(errorCode == 100){
+        return AUTHENTICATION_EXCEPTION_NAME;
+    }else if(errorCode == 101){
+        return INVALID_PASSWORD_EXCEPTION_NAME;
+    }else if(errorCode == 102){
+        return HID_CREDENTIALS_EXPIRED_EXCEPTION_NAME;
+    }else if(errorCode == 103){
+        return PASSWORD_EXPIRED_EXCEPTION_NAME;
+    }else if(errorCode == 105){
+        return PASSWORD_REQUIRED_EXCEPTION_NAME;
+    }else if(errorCode == 106){
+        return LOST_CREDENTIALS_EXCEPTION_NAME;
+    }else if(errorCode == 203){
+        return PASSWORD_CANCELLED_EXCEPTION_NAME;
+    }else if(errorCode == 300){
+        return SERVER_AUTH_EXCEPTION_NAME;
+    }else if(errorCode == 301){
+        return HID_SERVER_VERSION_EXCEPTION_NAME;
+    }else if(errorCode == 304){
+        return HID_SERVER_UNSUPPORTED_OPERATION_NAME;
+    }else if(errorCode == 305){
+        return HID_SERVER_OPERATION_FAILED_EXCEPTION_NAME;
+    }else if(errorCode == 1000){
+        return TRANSACTION_EXPIRED_EXCEPTION_NAME;
+    }else if(errorCode == 1002){
+        return HID_TRANSACTION_CANCELED_EXCEPTION_NAME;
+    }else if(errorCode == 1003){
+        return HID_TRANSACTION_SIGNED_EXCEPTION_NAME;
+    }
+    return HID_GENERIC_EXCEPTION;
+}
+
 /**
 * This method is used to retrieve the transaction details.
 *
@@ -1462,8 +3778,7 @@
 -(NSString *) retreiveTransaction:(NSString *)txID withPassword:(NSString *)pwd isBioEnabled:(bool)isBioEnabled withCallback:(JSValue *)callback{
     NSError* deviceError;
     NSError* error;
-    HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-    id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+    id<HIDDevice> pDevice = [self getDevice:&deviceError];
     if(deviceError != nil){
         int errorCodeDevice = (int)[deviceError code];
         if(errorCodeDevice == 0){
@@ -1487,12 +3802,15 @@
             return @"";
         }
     }
-    id<HIDServerActionInfo> transactionInfo = [pDevice retrieveActionInfo:txID error:&error];
-    id<HIDContainer> pContainer = [transactionInfo getContainer:&error];
+    TransactionCacheEntry *transactionEntry = [self retrieveTransactionEntry:txID fromDevice:pDevice error:&error];
+    id<HIDContainer> pContainer = transactionEntry.container;
     NSString* username = [pContainer getUserId];
-    _username = username;
-    id<HIDTransaction> pTransaction = (id<HIDTransaction>)[transactionInfo getAction:nil withParams:nil error:&error];
-    id<HIDPasswordPolicy> pPolicy = (id<HIDPasswordPolicy>) [pContainer getProtectionPolicy:&error];
+    [self adoptUsername:username from:@"retreiveTransaction"];
+    id<HIDTransaction> pTransaction = transactionEntry.transaction;
+    id<HIDPasswordPolicy> pPolicy = (id<HIDPasswordPolicy>)transactionEntry.protectionPolicy;
+    if(pPolicy == nil){
+        pPolicy = (id<HIDPasswordPolicy>) [pContainer getProtectionPolicy:&error];
+    }
     
     if (error != nil){
         int errorCode = (int)[error code];
@@ -1539,10 +3857,11 @@
         }
     }
     
-    NSString* tds = [pTransaction toString];
+    NSString* tds = transactionEntry.transactionString;
     NSLog(@"ApproveSDKWrapper ---> HID:retreiveTransaction tds is %@", tds);
-    NSDictionary *dict = [NSDictionary dictionaryWithObjectsAndKeys:
-                          tds, @"tds", username, @"username", nil];
+    NSMutableDictionary *dict = [NSMutableDictionary dictionary];
+    dict[@"tds"] = tds;
+    dict[@"username"] = username;
     NSError *jsonError;
     NSData *jsonData = [NSJSONSerialization dataWithJSONObject:dict options: NSJSONWritingPrettyPrinted error:&jsonError];
     if(!jsonData){
@@ -1569,14 +3888,17 @@
 -(void) setNotificationStatus:(NSString *)txID withStatus:(NSString *)status withPassword:(id)pwd withJSCallback:(JSValue *)onCompleteCB withPwdPromptCB:(JSValue *)pwdPromptCB{
     dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),^{
         bool isPasswordTimeoutFlow = ![pwd isEqualToString:@""];
+        if([self isTransactionKnownExpired:txID]){
+            NSLog(@"ApproveSDKWrapper ---> HID:setNotificationStatus Transaction Expired Exception %@", txID);
+            [self executeGenericCallback:pwdPromptCB withParams:(@[TRANSACTION_EXPIRED_EXCEPTION_NAME,TRANSACTION_EXPIRED_CODE])];
+            return;
+        }
         NSError* deviceError;
         NSError* error;
-        HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-        id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
-        
-        id<HIDServerActionInfo> transactionInfo = [pDevice retrieveActionInfo:txID error:&error];
+        id<HIDDevice> pDevice = [self getDevice:&deviceError];
         
-        id<HIDTransaction> pTransaction = (id<HIDTransaction>)[transactionInfo getAction:nil withParams:nil error:&error];
+        TransactionCacheEntry *transactionEntry = [self retrieveTransactionEntry:txID fromDevice:pDevice error:&error];
+        id<HIDTransaction> pTransaction = transactionEntry.transaction;
         if(error != nil){
             int errorCode = (int)[error code];
             if(errorCode == 100){
@@ -1612,10 +3934,13 @@
             }
         }
         if(isPasswordTimeoutFlow){
-            [self invokePasswordAuthNotification:(pTransaction) withPassword:(pwd) withStatus:(status) withCompletionCB:(onCompleteCB) withPwdPromptCB:(pwdPromptCB)];
+            [self invokePasswordAuthNotification:(pTransaction) withTransactionId:(txID) withPassword:(pwd) withStatus:(status) withCompletionCB:(onCompleteCB) withPwdPromptCB:(pwdPromptCB)];
             return;
         }
         bool result = [pTransaction setStatus:status withSigningPassword:nil withSessionPassword:(nil) withParams:nil error:(&error)];
+        if(deviceError == nil){
+            [self evictCachedTransaction:txID afterError:error];
+        }
         if(error != nil){
             int errorCode = (int)[error code];
             if(errorCode == 105 || errorCode == 203){
@@ -1675,20 +4000,145 @@
     });
 }
 
+/**
+* This method sets the notification status for several transactions/notifications at once.
+* The first valid, non-expired status update authenticates the user (password or biometrics); once any update fails
+* authentication the updates not yet attempted are reported with the same exception instead of prompting again. The remaining updates are
+* pipelined with bounded concurrency when a password is provided or the password policy caches authentication.
+*
+* @param statusRequests - JSON array of {"txID": "...", "status": "approve|deny|report"} objects.
+* @param pwd - The password for authentication, pass "" if biometrics are enabled.
+* @param onCompleteCB - The callback function to execute with the per-transaction outcomes, in request order.
+*/
+-(void) setNotificationStatuses:(NSString *)statusRequests withPassword:(NSString *)pwd withJSCallback:(JSValue *)onCompleteCB{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),^{
+        NSData* requestData = [statusRequests dataUsingEncoding:NSUTF8StringEncoding];
+        id requests = requestData != nil ? [NSJSONSerialization JSONObjectWithData:requestData options:0 error:nil] : nil;
+        if(![requests isKindOfClass:[NSArray class]] || [requests count] == 0){
+            NSLog(@"ApproveSDKWrapper ---> HID:setNotificationStatuses Invalid status requests %@", statusRequests);
+            [self executeGenericCallback:onCompleteCB withParams:@[@"failure", INVALID_PARAMETER_EXCEPTION, INVALID_PARAMETER_CODE]];
+            return;
+        }
+        NSError* deviceError;
+        id<HIDDevice> pDevice = [self getDevice:&deviceError];
+        if(deviceError != nil){
+            int errorCodeDevice = (int)[deviceError code];
+            NSLog(@"ApproveSDKWrapper ---> HID:setNotificationStatuses Error while creating HID Device %@", [deviceError localizedDescription]);
+            [self executeGenericCallback:onCompleteCB withParams:@[@"failure", [self transactionExceptionName:errorCodeDevice], @(errorCodeDevice)]];
+            return;
+        }
+        NSString* signingPassword = [self isEmptyString:pwd] ? nil : pwd;
+        NSUInteger count = [requests count];
+        NSMutableArray* results = [NSMutableArray arrayWithCapacity:count];
+        for(NSUInteger i = 0; i < count; i++){
+            [results addObject:[NSNull null]];
+        }
+        __block int authErrorCode = -1;
+        __block id<HIDContainer> probeContainer;
+        bool (^setStatusAtIndex)(NSUInteger) = ^bool(NSUInteger i){
+            NSDictionary* request = [requests objectAtIndex:i];
+            NSString* txID = [request isKindOfClass:[NSDictionary class]] ? request[@"txID"] : nil;
+            NSString* status = [request isKindOfClass:[NSDictionary class]] ? request[@"status"] : nil;
+            NSDictionary* item;
+            NSError* error;
+            bool isAttempted = false;
+            int failedAuthCode;
+            @synchronized (results) {
+                failedAuthCode = authErrorCode;
+            }
+            if(![txID isKindOfClass:[NSString class]] || ![status isKindOfClass:[NSString class]]){
+                item = [NSDictionary dictionaryWithObjectsAndKeys:@"failure", @"status", INVALID_PARAMETER_EXCEPTION, @"exception", INVALID_PARAMETER_CODE, @"code", nil];
+            }else if([self isTransactionKnownExpired:txID]){
+                item = [NSDictionary dictionaryWithObjectsAndKeys:txID, @"txID", @"failure", @"status", TRANSACTION_EXPIRED_EXCEPTION_NAME, @"exception", @1000, @"code", nil];
+            }else if(failedAuthCode != -1){
+                // Authentication already failed for this batch, don't retry it against the lockout counter
+                item = [NSDictionary dictionaryWithObjectsAndKeys:txID, @"txID", @"failure", @"status",
+                        [self transactionExceptionName:failedAuthCode], @"exception", @(failedAuthCode), @"code", nil];
+            }else{
+                isAttempted = true;
+                TransactionCacheEntry *transactionEntry = [self retrieveTransactionEntry:txID fromDevice:pDevice error:&error];
+                bool result = false;
+                if(transactionEntry != nil){
+                    result = [transactionEntry.transaction setStatus:status withSigningPassword:signingPassword withSessionPassword:nil withParams:nil error:&error];
+                    [self evictCachedTransaction:txID afterError:error];
+                }
+                if(error != nil){
+                    int errorCode = (int)[error code];
+                    NSLog(@"ApproveSDKWrapper ---> HID:setNotificationStatuses Error While Updating the notification status %@ %@", txID, [error localizedDescription]);
+                    item = [NSDictionary dictionaryWithObjectsAndKeys:txID, @"txID", @"failure", @"status",
+                            [self transactionExceptionName:errorCode], @"exception", @(errorCode), @"code", nil];
+                    if(errorCode == 100 || errorCode == 101 || errorCode == 105 || errorCode == 203){
+                        @synchronized (results) {
+                            authErrorCode = errorCode;
+                        }
+                    }
+                }else{
+                    item = [NSDictionary dictionaryWithObjectsAndKeys:txID, @"txID", @"success", @"status", result?@"true":@"false", @"result", nil];
+                }
+                @synchronized (results) {
+                    if(probeContainer == nil){
+                        probeContainer = transactionEntry.container;
+                    }
+                }
+            }
+            @synchronized (results) {
+                [results replaceObjectAtIndex:i withObject:item];
+            }
+            return isAttempted;
+        };
+        // The first valid, non-expired request authenticates the user, invalid or expired ones ahead of it are settled on the way
+        NSUInteger next = 0;
+        while(next < count && !setStatusAtIndex(next)){
+            next++;
+        }
+        next++;
+        if(next < count){
+            id<HIDProtectionPolicy> policy = [probeContainer getProtectionPolicy:nil];
+            bool isAuthenticationCached = policy != nil && [policy policyType] != HIDPolicyTypeDevice
+                && [(NSObject *)policy conformsToProtocol:@protocol(HIDPasswordPolicy)] && [(id<HIDPasswordPolicy>)policy isCacheEnabled];
+            long concurrency = (authErrorCode == -1 && (signingPassword != nil || isAuthenticationCached)) ? NOTIFICATION_STATUS_BATCH_CONCURRENCY : 1;
+            dispatch_group_t statusGroup = dispatch_group_create();
+            dispatch_semaphore_t statusSlots = dispatch_semaphore_create(concurrency);
+            for(NSUInteger i = next; i < count; i++){
+                dispatch_semaphore_wait(statusSlots, DISPATCH_TIME_FOREVER);
+                dispatch_group_async(statusGroup, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+                    setStatusAtIndex(i);
+                    dispatch_semaphore_signal(statusSlots);
+                });
+            }
+            dispatch_group_wait(statusGroup, DISPATCH_TIME_FOREVER);
+        }
+        NSDictionary* jsonObj = [NSDictionary dictionaryWithObjectsAndKeys:results, @"results", nil];
+        NSError *jsonError;
+        NSData *jsonData = [NSJSONSerialization dataWithJSONObject:jsonObj options: NSJSONWritingPrettyPrinted error:&jsonError];
+        if(!jsonData){
+            NSLog(@"ApproveSDKWrapper ---> HID:setNotificationStatuses Error while converting JSON %@", jsonError);
+            [self executeGenericCallback:onCompleteCB withParams:@[@"failure", [jsonError localizedDescription]]];
+        }else{
+            NSString *jsonString = [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
+            [self executeGenericCallback:onCompleteCB withParams:(@[@"success",jsonString])];
+        }
+    });
+}
+
 /**
 *
 *This method is used to invoke the password authentication notification for Set Notification Status flow.
 *
 *@param transaction - The HIDTransaction object representing the transaction.
+*@param txID - The transaction ID, used to evict the cached transaction once it is final.
 *@param pwd - The password to authenticate the transaction.
 *@param status - The status to set for the transaction.
 *@param onCompleteCB - The callback function to execute after setting the status.
 *@param promptCB - The callback function to prompt for password, if required.
 */
--(void)invokePasswordAuthNotification: (id<HIDTransaction>) transaction withPassword : (NSString*)pwd withStatus : (NSString* ) status withCompletionCB :(JSValue* )onCompleteCB withPwdPromptCB : (JSValue *)promptCB {
+-(void)invokePasswordAuthNotification: (id<HIDTransaction>) transaction withTransactionId : (NSString*)txID withPassword : (NSString*)pwd withStatus : (NSString* ) status withCompletionCB :(JSValue* )onCompleteCB withPwdPromptCB : (JSValue *)promptCB {
     NSError* error;
     NSLog(@"ApproveSDKWrapper ---> HID:invokePasswordAuthNotification Inside Password TimeOut flow");
     bool result = [transaction setStatus:status withSigningPassword:pwd withSessionPassword:(nil) withParams:nil error:(&error)];
+    if(transaction != nil){
+        [self evictCachedTransaction:txID afterError:error];
+    }
     if(error != nil){
         int errorCode = (int)[error code];
         if(errorCode == 100 || errorCode == 105){
@@ -1724,6 +4174,184 @@
     }
 }
 
+/**
+* This method prefetches a transaction in the background, typically from the push notification handler,
+* so that the following retreiveTransaction/setNotificationStatus completes from the warm cache.
+* The protection policy is resolved along with the transaction, and the biometric state table is warmed.
+*
+* @param txID - Transaction ID received in the push notification.
+*/
+-(void)prefetchTransaction:(NSString *)txID{
+    if([self isEmptyString:txID]){
+        return;
+    }
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0),^{
+        NSError* deviceError;
+        NSError* error;
+        id<HIDDevice> pDevice = [self getDevice:&deviceError];
+        if(deviceError != nil){
+            NSLog(@"ApproveSDKWrapper ---> HID:prefetchTransaction Error while creating HID Device %@", [deviceError localizedDescription]);
+            return;
+        }
+        TransactionCacheEntry *transactionEntry = [self retrieveTransactionEntry:txID fromDevice:pDevice error:&error];
+        if(transactionEntry == nil){
+            NSLog(@"ApproveSDKWrapper ---> HID:prefetchTransaction Error while retreiving transaction %@", [error localizedDescription]);
+            return;
+        }
+        if(transactionEntry.protectionPolicy == nil){
+            transactionEntry.protectionPolicy = [transactionEntry.container getProtectionPolicy:nil];
+        }
+        // Answers checkBioAvailability on the approval screen; kept current by enable/disableBiometrics
+        [self bioStateTable:nil];
+        NSLog(@"ApproveSDKWrapper ---> HID:prefetchTransaction Prefetched transaction %@", txID);
+    });
+}
+
+/**
+* This method returns the transaction for the given ID, reusing a previously retrieved one while it is still valid.
+* A cache miss retrieves the action info, transaction and container from the server and caches them until the transaction expires.
+* Concurrent misses for the same ID (e.g. a prefetch still in flight) wait for the first retrieval instead of repeating it.
+*
+* @param txID - Transaction ID to retrieve.
+* @param pDevice - HID Device used on a cache miss.
+* @param error - Set when the transaction could not be retrieved.
+*
+* @return TransactionCacheEntry - The retrieved transaction, or nil on error.
+*/
+-(TransactionCacheEntry *)retrieveTransactionEntry:(NSString *)txID fromDevice:(id<HIDDevice>)pDevice error:(NSError **)error {
+    TransactionCacheEntry *entry = [self.transactionCache objectForKey:txID];
+    if(entry != nil){
+        NSLog(@"ApproveSDKWrapper ---> HID:retrieveTransactionEntry Using cached transaction %@", txID);
+        return entry;
+    }
+    dispatch_group_t fetchGroup;
+    bool isFetchOwner = false;
+    @synchronized (self.transactionFetches) {
+        fetchGroup = self.transactionFetches[txID];
+        if(fetchGroup == nil){
+            fetchGroup = dispatch_group_create();
+            dispatch_group_enter(fetchGroup);
+            self.transactionFetches[txID] = fetchGroup;
+            isFetchOwner = true;
+        }
+    }
+    if(!isFetchOwner){
+        NSLog(@"ApproveSDKWrapper ---> HID:retrieveTransactionEntry Waiting for in-flight retrieval of %@", txID);
+        dispatch_group_wait(fetchGroup, DISPATCH_TIME_FOREVER);
+        entry = [self.transactionCache objectForKey:txID];
+        if(entry != nil){
+            return entry;
+        }
+    }
+    entry = [self fetchTransactionEntry:txID fromDevice:pDevice error:error];
+    if(isFetchOwner){
+        @synchronized (self.transactionFetches) {
+            [self.transactionFetches removeObjectForKey:txID];
+        }
+        dispatch_group_leave(fetchGroup);
+    }
+    return entry;
+}
+
+/**
+* This method retrieves the action info, transaction and container from the server and caches them until the transaction expires.
+*
+* @param txID - Transaction ID to retrieve.
+* @param pDevice - HID Device to retrieve the transaction from.
+* @param error - Set when the transaction could not be retrieved.
+*
+* @return TransactionCacheEntry - The retrieved transaction, or nil on error.
+*/
+-(TransactionCacheEntry *)fetchTransactionEntry:(NSString *)txID fromDevice:(id<HIDDevice>)pDevice error:(NSError **)error {
+    if(pDevice == nil){
+        if(error != nil){
+            *error = [NSError errorWithDomain:HIDErrorDomain code:HIDInvalidArgument userInfo:@{NSLocalizedDescriptionKey: @"HID Device is not available"}];
+        }
+        return nil;
+    }
+    NSError *fetchError;
+    id<HIDServerActionInfo> transactionInfo = [pDevice retrieveActionInfo:txID error:&fetchError];
+    id<HIDTransaction> pTransaction = (id<HIDTransaction>)[transactionInfo getAction:nil withParams:nil error:&fetchError];
+    id<HIDContainer> pContainer = [transactionInfo getContainer:&fetchError];
+    if(fetchError == nil && pTransaction == nil){
+        fetchError = [NSError errorWithDomain:HIDErrorDomain code:HIDUnsupportedOperation userInfo:@{NSLocalizedDescriptionKey: @"Action is not a transaction"}];
+    }
+    if(fetchError != nil || pTransaction == nil){
+        if(error != nil){
+            *error = fetchError;
+        }
+        return nil;
+    }
+    TransactionCacheEntry *entry = [[TransactionCacheEntry alloc] init];
+    entry.actionInfo = transactionInfo;
+    entry.transaction = pTransaction;
+    entry.container = pContainer;
+    entry.transactionString = [pTransaction toString];
+    NSDate *expiryDate = [pTransaction getExpiryDate:nil];
+    if(expiryDate == nil){
+        expiryDate = [NSDate dateWithTimeIntervalSinceNow:TRANSACTION_CACHE_DEFAULT_TTL_SECONDS];
+    }else{
+        [self.expiryWheel scheduleKey:txID expiryDate:expiryDate];
+    }
+    entry.expiryDate = expiryDate;
+    [self.transactionCache setObject:entry forKey:txID expiryDate:expiryDate];
+    return entry;
+}
+
+/**
+* This method evicts the cached transaction once it can no longer be acted on,
+* i.e. after a successful status update/cancel or when the server reports it expired, canceled or already signed.
+*
+* @param txID - Transaction ID to evict.
+* @param error - Error returned by the status update/cancel, nil on success.
+*/
+-(void)evictCachedTransaction:(NSString *)txID afterError:(NSError *)error {
+    int errorCode = error != nil ? (int)[error code] : -1;
+    if(error == nil || errorCode == 1000 || errorCode == 1002 || errorCode == 1003){
+        [self.transactionCache removeObjectForKey:txID];
+        [self.expiryWheel cancelKey:txID];
+    }
+    if(errorCode == 1000){
+        [self.expiredTransactions setObject:txID forKey:txID expiryDate:[NSDate distantFuture]];
+    }
+}
+
+/**
+* This method is invoked by the expiry timer wheel when a fetched transaction reaches its expiry date.
+* The transaction is evicted from the caches, remembered as expired and an "expired" event is sent to JS.
+*
+* @param txID - Transaction ID that expired.
+*/
+-(void)onTransactionExpired:(NSString *)txID {
+    NSLog(@"ApproveSDKWrapper ---> HID:onTransactionExpired Transaction %@ expired", txID);
+    [self.transactionCache removeObjectForKey:txID];
+    [self.expiredTransactions setObject:txID forKey:txID expiryDate:[NSDate distantFuture]];
+    JSValue *eventCallback = self.transactionEventCallback;
+    if(eventCallback != nil){
+        [self executeGenericCallback:eventCallback withParams:@[@"expired", txID]];
+    }
+}
+
+/**
+* This method checks whether the transaction is already known to be expired, so status updates can fail without a server round trip.
+*
+* @param txID - Transaction ID to check.
+*
+* @return bool - true if the transaction is known to be expired.
+*/
+-(bool)isTransactionKnownExpired:(NSString *)txID {
+    return [self.expiredTransactions objectForKey:txID] != nil;
+}
+
+/**
+* This method registers the callback receiving transaction events, e.g. ("expired", txID) when a fetched transaction expires.
+*
+* @param callback - The callback function to execute on transaction events.
+*/
+-(void)setTransactionEventCallback:(JSValue *)callback {
+    _transactionEventCallback = callback;
+}
+
 /**
 * This public method is used to cancel a transaction.
 *
@@ -1737,8 +4365,7 @@
     dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
         NSError* deviceError;
         NSError* error;
-        HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-        id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+        id<HIDDevice> pDevice = [self getDevice:&deviceError];
         
         if(deviceError != nil){
             int errorCodeDevice = (int)[deviceError code];
@@ -1765,14 +4392,13 @@
             }
         }
         
-        id<HIDServerActionInfo> transactionInfo = [pDevice retrieveActionInfo:txId error:&error];
+        TransactionCacheEntry *transactionEntry = [self retrieveTransactionEntry:txId fromDevice:pDevice error:&error];
         
-        
-        id<HIDTransaction> pTransaction = (id<HIDTransaction>)[transactionInfo getAction:nil withParams:nil error:&error];
+        id<HIDTransaction> pTransaction = transactionEntry.transaction;
         
         NSString *transactionString = pTransaction.toString;
         
-        id<HIDContainer> pContainer = [transactionInfo getContainer:&error];
+        id<HIDContainer> pContainer = transactionEntry.container;
         
         if(transactionString == nil){
             NSLog(@"ApproveSDKWrapper ---> HID:transactionCancel Transaction is Empty %@", [error localizedDescription]);
@@ -1812,6 +4438,7 @@
             [self executeGenericCallback:cancelCallback withParams:@[@"error", @"Invalid reason provided"]];
             return;
         }
+        [self evictCachedTransaction:txId afterError:error];
         
         if(error != nil){
             int errorCode = (int)[error code];
@@ -1869,7 +4496,14 @@
 * @param username - Username to be set.
 */
 -(void)setUsername:(NSString *)username {
+    if(username != nil && self.isUserBound){
+        [self adoptUsername:username from:@"setUsername"];
+        return;
+    }
     if(username != nil){
+        if(![username isEqualToString:_username]){
+            [self invalidateCredentialCaches];
+        }
         _username = username;
         NSLog(@"ApproveSDKWrapper ---> HID:setUsername Username is %@", _username);
     }
@@ -1916,29 +4550,54 @@
 * @return bool indicating whether the device is multi user or not.
 */
 -(bool) checkMultiuserBioStatus{
-    NSError* deviceError;
     NSError* containerError;
-    HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-    id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
-    if(deviceError != nil){
-        NSLog(@"ApproveSDKWrapper ---> HID:checkMultiuserBioStatus device Error: %@",[deviceError localizedDescription]);
+    BioStateTable *bioStates = [self bioStateTable:&containerError];
+    if(bioStates == nil){
+        NSLog(@"ApproveSDKWrapper ---> HID:checkMultiuserBioStatus container Error: %@",[containerError localizedDescription]);
         return FALSE;
     }
-    NSMutableArray* filterContainers = [[NSMutableArray alloc]init];
-    NSArray* pContainers = [pDevice findContainers:(filterContainers) error:(&containerError)];
-    for(id<HIDContainer> pConatiner in pContainers){
-        id<HIDBioPasswordPolicy> bioPasswordPolicy = (id<HIDBioPasswordPolicy>)[pConatiner getProtectionPolicy:(&containerError)];
-        if([bioPasswordPolicy getBioAuthenticationState] == HIDBioAuthenticationStateEnabled){
-            return FALSE;
-        }
+    if([bioStates isAnyBioEnabled]){
+        return FALSE;
     }
-    if(containerError != nil){
-        NSLog(@"ApproveSDKWrapper ---> HID:checkMultiuserBioStatus container Error: %@",[deviceError localizedDescription]);
+    if(bioStates.hasPolicyError){
+        NSLog(@"ApproveSDKWrapper ---> HID:checkMultiuserBioStatus container Error while reading protection policies");
         return FALSE;
     }
     return TRUE;
 }
 
+/**
+* This method checks if biometrics are enabled for the current user, answered from the biometric state table.
+*
+* @return bool indicating whether a container of the current user has biometrics enabled.
+*/
+-(bool) checkUserBioStatus{
+    NSError* containerError;
+    id<HIDContainer> pContainer = [self getSingleUserContainer];
+    BioStateTable *bioStates = [self bioStateTable:&containerError];
+    if(pContainer == nil || bioStates == nil){
+        NSLog(@"ApproveSDKWrapper ---> HID:checkUserBioStatus container Error: %@",[containerError localizedDescription]);
+        return FALSE;
+    }
+    return [bioStates isBioEnabledForUserId:[pContainer getUserId]];
+}
+
+/**
+* This method checks if biometrics are enabled by any user other than the current one, answered from the biometric state table.
+*
+* @return bool indicating whether a container of another user has biometrics enabled.
+*/
+-(bool) checkOtherUsersBioStatus{
+    NSError* containerError;
+    id<HIDContainer> pContainer = [self getSingleUserContainer];
+    BioStateTable *bioStates = [self bioStateTable:&containerError];
+    if(bioStates == nil){
+        NSLog(@"ApproveSDKWrapper ---> HID:checkOtherUsersBioStatus container Error: %@",[containerError localizedDescription]);
+        return FALSE;
+    }
+    return [bioStates isBioEnabledForOtherThanUserId:[pContainer getUserId]];
+}
+
 /**
 * This method deletes the container with authentication.
 *
@@ -2106,62 +4765,46 @@
 */
 -(NSString *)getMultiContainerFriendlyName {
     
-    NSError* deviceError;
     NSError* containerError;
-    HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-    id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
-    
-    if (deviceError != nil) {
-        int errorCodeDevice = (int)[deviceError code];
-        
-        if(errorCodeDevice == 0){
-            NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName Internal Exception while creating container %@", [deviceError localizedDescription]);
-        }else if(errorCodeDevice == 3){
-            NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName Invalid Argument Exception while creating container %@", [deviceError localizedDescription]);
-        }else if(errorCodeDevice == 7){
-            NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName Unsupported Version Exception while creating container %@", [deviceError localizedDescription]);
-        }else if (errorCodeDevice == 106){
-            NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName Lost Credentials Exception while creating container %@", [deviceError localizedDescription]);
-        }else{
-            NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName error while creating container %@", [deviceError localizedDescription]);
-        }
-        return @"error";
-    }
+    ContainerDirectory *directory = [self containerDirectory:&containerError];
     
-    NSMutableArray *filterContainers = [[NSMutableArray alloc] init];
-    NSArray *pContainers = [pDevice findContainers:filterContainers error:&containerError];
-    if (containerError != nil) {
+    if (directory == nil) {
         int errorCodeContainer = (int)[containerError code];
         
         if(errorCodeContainer == 0){
             NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName Internal Exception while creating container %@", [containerError localizedDescription]);
         }else if(errorCodeContainer == 3){
             NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName Invalid Argument Exception while creating container %@", [containerError localizedDescription]);
+        }else if(errorCodeContainer == 7){
+            NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName Unsupported Version Exception while creating container %@", [containerError localizedDescription]);
+        }else if (errorCodeContainer == 106){
+            NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName Lost Credentials Exception while creating container %@", [containerError localizedDescription]);
         }else{
             NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName error while creating container %@", [containerError localizedDescription]);
         }
         return @"error";
     }
     
-    if ([pContainers count] == 0) {
+    NSArray<ContainerDirectoryEntry *> *entries = [directory entriesWithFriendlyNames];
+    if ([entries count] == 0) {
         NSLog(@"ApproveSDKWrapper ---> HID:getMultiContainerFriendlyName getMultiContainerFriendlyName No Containers Found, prompting for register");
         return @"Register";
     }
     
-    if ([pContainers count] == 1) {
+    if ([entries count] == 1) {
         
         NSString *loginType = @"SingleLogin:";
-        NSString *username = [pContainers[0] getUserId];
-        NSString *getName = [pContainers[0] getName];
+        NSString *username = entries[0].userId;
+        NSString *getName = entries[0].friendlyName;
         NSLog(@"ApproveSDK ---> HID:getMultiContainerFriendlyName getMultiContainerFriendlyName: %@", [loginType stringByAppendingFormat:@"%@,%@", username, getName]);
         return [loginType stringByAppendingFormat:@"%@,%@", username, getName];
     } else {
         NSMutableString *multiflowString = [[NSMutableString alloc] initWithString:@"MultiLogin:"];
         
-        for (id<HIDContainer> pContainerLoop in pContainers) {
-            [multiflowString appendString:[pContainerLoop getUserId]];
+        for (ContainerDirectoryEntry *entry in entries) {
+            [multiflowString appendString:entry.userId];
             [multiflowString appendString:@","];
-            [multiflowString appendString:[pContainerLoop getName]];
+            [multiflowString appendString:entry.friendlyName];
             [multiflowString appendString:@"|"];
         }
         
@@ -2179,21 +4822,12 @@
 * @param setNameCallback - The callback function to execute after setting the name for success and failure response.
 */
 - (void)setContainerFriendlyName:(NSString *)username withFriendlyName: (NSString *)friendlyName withSetNameCallback : (JSValue *)setNameCallback{
-    NSError* deviceError;
     NSError* containerError;
-    HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-    id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
-    
-    if (deviceError != nil) {
-        NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName error while creating container %@", [deviceError localizedDescription]);
-        [self executeGenericCallback:setNameCallback withParams:(@[@"Device Error",@"error"])];
-    }
-    
-    NSMutableArray *filterContainers = [[NSMutableArray alloc] init];
-    NSArray *pContainers = [pDevice findContainers:filterContainers error:&containerError];
-    if (containerError != nil) {
+    ContainerDirectory *directory = [self containerDirectory:&containerError];
+    if (directory == nil) {
         NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName error while creating container %@", [containerError localizedDescription]);
         [self executeGenericCallback:setNameCallback withParams:(@[@"Container Error",@"error"])];
+        return;
     }
     
     NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName HID In setContainerFriendlyName");
@@ -2201,25 +4835,37 @@
     NSError *error = nil;
     
     username = [username stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
-    _username = username;
+    if (![self adoptUsername:username from:@"setContainerFriendlyName"]) {
+        //A session only renames the containers of its own user
+        [self executeGenericCallback:setNameCallback withParams:(@[INVALID_PARAMETER_EXCEPTION,INVALID_PARAMETER_CODE])];
+        return;
+    }
     
     NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName Wrapper Username --> %@", _username);
     NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName Username --> %@", username);
     
-    for (id<HIDContainer> c in pContainers) {
-        NSString *userId = [[c getUserId] stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
-        NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName Container UserId--> %@", userId);
-        
-        if ([username isEqualToString:userId]) {
-            NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName Container Name matched with userId--> %@ %@", username, userId);
-            NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName Friendly Name --> %@", friendlyName);
-            [c setName:friendlyName error:&error];
-            NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName New Friendly Name --> %@", friendlyName);
-            [self executeGenericCallback:setNameCallback withParams:(@[@"Container Friendly Name Set Successfully", @"success"])];
+    NSArray<ContainerDirectoryEntry *> *entries = [directory entriesForUserId:username];
+    NSUInteger renamedCount = 0;
+    for (ContainerDirectoryEntry *entry in entries) {
+        NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName Container Name matched with userId--> %@ %@", username, entry.userId);
+        NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName Friendly Name --> %@", friendlyName);
+        [entry.container setName:friendlyName error:&error];
+        if (error != nil) {
+            break;
         }
+        renamedCount++;
+        NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName New Friendly Name --> %@", friendlyName);
+    }
+    if (renamedCount > 0) {
+        [self containersDidChange];
     }
     
-    if(error != nil){
+    if ([entries count] == 0) {
+        NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName No Container found for %@", username);
+        [self executeGenericCallback:setNameCallback withParams:(@[@"Container Error",@"error"])];
+    }else if(error == nil){
+        [self executeGenericCallback:setNameCallback withParams:(@[@"Container Friendly Name Set Successfully", @"success"])];
+    }else{
         int errorCode = (int)[error code];
         if(errorCode == 200){
             NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName Error While setContainerFriendlyName %@", @"UnsupportedDeviceException");
@@ -2235,6 +4881,7 @@
             [self executeGenericCallback:setNameCallback withParams:(@[INVALID_PARAMETER_EXCEPTION,INVALID_PARAMETER_CODE])];
         }else{
             NSLog(@"ApproveSDKWrapper ---> HID:setContainerFriendlyName Error While Updating the notification status %@", [error localizedDescription] );
+            [self executeGenericCallback:setNameCallback withParams:(@[@"Container Error",[error localizedDescription]])];
         }
     }
 }
@@ -2366,15 +5013,134 @@
 * @return NSString - A JSON string containing device and container information.
 */
 -(NSString *)getInfo{
+    NSString *errorMessage = nil;
+    NSDictionary *getInfo = [self buildInfo:&errorMessage];
+    if (getInfo == nil) {
+        return errorMessage;
+    }
+    
+    NSError *error;
+    NSData *infoD = [NSJSONSerialization dataWithJSONObject:getInfo options:NSJSONWritingPrettyPrinted error:&error];
+    if (!infoD){
+        NSLog(@"ApproveSDKWrapper ---> HID:getInfo: JSON Error: %@", error.localizedDescription);
+        return nil;
+    }
+
+    NSString *info = [[NSString alloc] initWithData:infoD encoding:NSUTF8StringEncoding];
+    NSLog(@"ApproveSDKWrapper ---> HID:getInfo Get Info: %@", info);
+    
+    return info;
+}
+
+/**
+* This method retrieves only the device and container fields that changed since a previous getInfoDelta call.
+*
+* @param sinceToken - The token returned by the previous call, or "" / "0" to get every field.
+*
+* @return NSString - A JSON string with the new "token", the changed "deviceInfo" fields, the changed "containerInfo" fields
+*                    (each entry carries its containerId) and the "removedContainers" ids, or the getInfo error message.
+*/
+-(NSString *)getInfoDelta:(NSString *)sinceToken{
+    NSString *errorMessage = nil;
+    NSDictionary *getInfo = [self buildInfo:&errorMessage];
+    if (getInfo == nil) {
+        return errorMessage;
+    }
+    unsigned long long since = (unsigned long long)MAX([sinceToken longLongValue], 0);
+    NSMutableDictionary *deviceDelta = [NSMutableDictionary dictionary];
+    NSMutableDictionary<NSString *, NSMutableDictionary *> *containerDeltas = [NSMutableDictionary dictionary];
+    NSMutableArray *removedContainers = [NSMutableArray array];
+    unsigned long long token;
+    @synchronized (self.infoFields) {
+        NSMutableDictionary *currentFields = [NSMutableDictionary dictionary];
+        [getInfo[@"deviceInfo"] enumerateKeysAndObjectsUsingBlock:^(NSString *field, id value, BOOL *stop) {
+            currentFields[[@"deviceInfo|" stringByAppendingString:field]] = value;
+        }];
+        NSMutableSet *containerIds = [NSMutableSet set];
+        for (NSDictionary *containerInfo in getInfo[@"containerInfo"]) {
+            NSString *containerId = containerInfo[@"containerId"];
+            [containerIds addObject:containerId];
+            [self.removedInfoContainers removeObjectForKey:containerId];
+            [containerInfo enumerateKeysAndObjectsUsingBlock:^(NSString *field, id value, BOOL *stop) {
+                currentFields[[NSString stringWithFormat:@"containerInfo|%@|%@", containerId, field]] = value;
+            }];
+        }
+        //A field that disappeared is recorded as null so that the caller clears it
+        for (NSString *path in [self.infoFields allKeys]) {
+            if (currentFields[path] == nil) {
+                NSArray *components = [path componentsSeparatedByString:@"|"];
+                if ([components[0] isEqualToString:@"containerInfo"] && ![containerIds containsObject:components[1]]) {
+                    if (self.removedInfoContainers[components[1]] == nil) {
+                        self.removedInfoContainers[components[1]] = @(++self.infoToken);
+                    }
+                    [self.infoFields removeObjectForKey:path];
+                } else if (self.infoFields[path][0] != [NSNull null]) {
+                    currentFields[path] = [NSNull null];
+                }
+            }
+        }
+        for (NSString *path in currentFields) {
+            NSArray *recorded = self.infoFields[path];
+            if (recorded == nil || ![recorded[0] isEqual:currentFields[path]]) {
+                self.infoFields[path] = @[currentFields[path], @(++self.infoToken)];
+            }
+        }
+        [self.infoFields enumerateKeysAndObjectsUsingBlock:^(NSString *path, NSArray *recorded, BOOL *stop) {
+            if ([recorded[1] unsignedLongLongValue] <= since) {
+                return;
+            }
+            NSArray *components = [path componentsSeparatedByString:@"|"];
+            if ([components[0] isEqualToString:@"deviceInfo"]) {
+                deviceDelta[components[1]] = recorded[0];
+            } else {
+                NSMutableDictionary *containerDelta = containerDeltas[components[1]];
+                if (containerDelta == nil) {
+                    containerDelta = [@{@"containerId": components[1]} mutableCopy];
+                    containerDeltas[components[1]] = containerDelta;
+                }
+                containerDelta[components[2]] = recorded[0];
+            }
+        }];
+        [self.removedInfoContainers enumerateKeysAndObjectsUsingBlock:^(NSString *containerId, NSNumber *removedToken, BOOL *stop) {
+            if ([removedToken unsignedLongLongValue] > since) {
+                [removedContainers addObject:containerId];
+            }
+        }];
+        token = self.infoToken;
+    }
+    
+    NSDictionary *delta = @{@"token": [NSString stringWithFormat:@"%llu", token],
+                            @"deviceInfo": deviceDelta,
+                            @"containerInfo": [containerDeltas allValues],
+                            @"removedContainers": removedContainers};
+    NSError *error;
+    NSData *deltaData = [NSJSONSerialization dataWithJSONObject:delta options:NSJSONWritingPrettyPrinted error:&error];
+    if (!deltaData){
+        NSLog(@"ApproveSDKWrapper ---> HID:getInfoDelta: JSON Error: %@", error.localizedDescription);
+        return nil;
+    }
+    NSString *info = [[NSString alloc] initWithData:deltaData encoding:NSUTF8StringEncoding];
+    NSLog(@"ApproveSDKWrapper ---> HID:getInfoDelta Get Info Delta: %@", info);
+    return info;
+}
+
+/**
+* This private method builds the device and container report returned by getInfo.
+* Device fields that cannot change while the app runs are read once per process, and container fields once per
+* container generation; the device name, rooted state and container renewability are read on every call.
+*
+* @param errorMessage - On failure, the message getInfo returns.
+*
+* @return NSDictionary - The report with "deviceInfo" and "containerInfo", or nil on failure.
+*/
+- (NSDictionary *)buildInfo:(NSString **)errorMessage {
     NSMutableDictionary *deviceInfo = [NSMutableDictionary dictionary];
-    NSMutableDictionary *containerInfo = [NSMutableDictionary dictionary];
     NSMutableArray *containerInfoArray = [NSMutableArray array];
     NSMutableDictionary *getInfo = [NSMutableDictionary dictionary];
     
     NSError* deviceError;
     NSError* containerError;
-    HIDConnectionConfiguration* connectionConfig = [[HIDConnectionConfiguration alloc] init];
-    id<HIDDevice> pDevice = [[HIDDeviceFactory alloc] getDevice:connectionConfig error:&deviceError];
+    id<HIDDevice> pDevice = [self getDevice:&deviceError];
     
     if (deviceError != nil) {
         NSLog(@"ApproveSDKWrapper ---> HID:getInfo Device Error User Info: %@", [deviceError userInfo]);
@@ -2382,87 +5148,123 @@
         int errorCode = (int)[deviceError code];
         if(errorCode == 0){
             NSLog(@"ApproveSDKWrapper ---> HID:getInfo HID Internal Exception %@", [deviceError localizedDescription]);
-            return @"HID Internal Exception";
+            *errorMessage = @"HID Internal Exception";
         }else if(errorCode == 3){
             NSLog(@"ApproveSDKWrapper ---> HID:getInfo HID Invalid Argument Exception %@", [deviceError localizedDescription]);
-            return @"HID Invalid Argument Exception";
+            *errorMessage = @"HID Invalid Argument Exception";
         }else if(errorCode == 7){
             NSLog(@"ApproveSDKWrapper ---> HID:getInfo HID Unsupported Version Exception %@", [deviceError localizedDescription]);
-            return @"HID Unsupported Version Exception";
+            *errorMessage = @"HID Unsupported Version Exception";
         }else if (errorCode == 106){
             NSLog(@"ApproveSDKWrapper ---> HID:getInfo Lost Credentials Exception %@", [deviceError localizedDescription]);
-            return @"Lost Credentials Exception";
+            *errorMessage = @"Lost Credentials Exception";
         }else{
-            return @"Device Error";
+            *errorMessage = @"Device Error";
         }
+        return nil;
     }
     
-    deviceInfo[@"deviceBrand"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_BRAND error:&deviceError];
-    deviceInfo[@"deviceModel"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_MODEL error:&deviceError];
+    NSDictionary *staticDeviceInfo = self.staticDeviceInfo;
+    if (staticDeviceInfo == nil) {
+        NSMutableDictionary *staticInfo = [NSMutableDictionary dictionary];
+        staticInfo[@"deviceBrand"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_BRAND error:&deviceError];
+        staticInfo[@"deviceModel"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_MODEL error:&deviceError];
+        staticInfo[@"deviceOS"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_OS error:&deviceError];
+        staticInfo[@"deviceOSName"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_OS_NAME error:&deviceError];
+        staticInfo[@"deviceOSVersion"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_OS_VERSION error:&deviceError];
+        staticInfo[@"deviceKeyStore"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_KEYSTORE error:&deviceError];
+        staticInfo[@"deviceHIDSDKVersion"] = [pDevice getVersion:&deviceError];
+        staticDeviceInfo = staticInfo;
+        if (deviceError != nil) {
+            // Read again on the next call rather than caching the missing fields for the whole process
+            NSLog(@"ApproveSDKWrapper ---> HID:getInfo error while reading device info %@", [deviceError localizedDescription]);
+            deviceError = nil;
+        } else {
+            self.staticDeviceInfo = staticDeviceInfo;
+        }
+    }
+    [deviceInfo addEntriesFromDictionary:staticDeviceInfo];
     deviceInfo[@"deviceFriendlyName"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_NAME error:&deviceError];
-    deviceInfo[@"deviceOS"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_OS error:&deviceError];
-    deviceInfo[@"deviceOSName"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_OS_NAME error:&deviceError];
-    deviceInfo[@"deviceOSVersion"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_OS_VERSION error:&deviceError];
-    deviceInfo[@"deviceKeyStore"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_KEYSTORE error:&deviceError];
     deviceInfo[@"deviceIsRooted"] = [pDevice getDeviceInfo:HID_DEVICE_INFO_ISROOTED error:&deviceError];
-    deviceInfo[@"deviceHIDSDKVersion"] = [pDevice getVersion:&deviceError];
+    if (deviceError != nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:getInfo error while reading device name or rooted state %@", [deviceError localizedDescription]);
+    }
     
     NSMutableArray *filterContainers = [[NSMutableArray alloc] init];
     NSArray *pContainers = [pDevice findContainers:filterContainers error:&containerError];
     if (containerError != nil) {
         NSLog(@"ApproveSDKWrapper ---> HID:getInfo error while findContainers %@", [containerError localizedDescription]);
-        int errorCode = (int)[deviceError code];
+        int errorCode = (int)[containerError code];
         if(errorCode == 0){
             NSLog(@"ApproveSDKWrapper ---> HID:getInfo HID Internal Exception while findContainers %@", [containerError localizedDescription]);
-            return @"HID Internal Exception";
+            *errorMessage = @"HID Internal Exception";
         }else if(errorCode == 3){
             NSLog(@"ApproveSDKWrapper ---> HID:getInfo HID Invalid Argument Exception while findContainers %@", [containerError localizedDescription]);
-            return @"HID Invalid Argument Exception";
+            *errorMessage = @"HID Invalid Argument Exception";
         }else{
             NSLog(@"ApproveSDKWrapper ---> HID:getInfo error while findContainers %@", [containerError localizedDescription]);
-            return @"Container Error";
+            *errorMessage = @"Container Error";
         }
+        return nil;
     }
     
     if ([pContainers count] == 0) {
         NSLog(@"ApproveSDKWrapper ---> HID:getInfo No Containers Found, prompting for register");
-        return @"No Container found";
+        *errorMessage = @"No Container found";
+        return nil;
     }
-     
     
+    NSUInteger generation = self.containerGeneration;
+    NSMutableDictionary<NSString *, NSDictionary *> *containerInfoCache = nil;
+    @synchronized (self.infoFields) {
+        if (self.containerInfoGeneration == generation && self.containerInfoCache != nil) {
+            containerInfoCache = [self.containerInfoCache mutableCopy];
+        }
+    }
+    if (containerInfoCache == nil) {
+        containerInfoCache = [NSMutableDictionary dictionary];
+    }
+    NSDateFormatter *formatter = [self infoDateFormatter];
     for(id<HIDContainer> container in pContainers){
-        containerInfo[@"serverURL"] = [container getServerURL];
-        containerInfo[@"serverDomain"] = [container getProperty:HID_PROPERTY_DOMAIN error:&containerError];
-        containerInfo[@"serverVersion"] = [container getProperty:HID_PROPERTY_PROTOCOL_VERSION error:&containerError];
-        containerInfo[@"deviceId"] = [self getDeviceProperty];
-        containerInfo[@"containerId"] = [NSString stringWithFormat:@"%ld", (long)[container getId]];
-        containerInfo[@"containerUserId"] = [container getUserId];
-        containerInfo[@"containerFriendlyName"] = [self getContainerFriendlyName];
-        NSDate *creationDate = [container getCreationDate:&containerError];
-        NSDate *expiryDate = [container getExpiryDate:&containerError];
-        NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
-        formatter.dateFormat = @"EEE MMM dd HH:mm:ss z yyyy";
-        containerInfo[@"containerCreationDate"] = [formatter stringFromDate:creationDate];
-        containerInfo[@"containerExpirationDate"] = [formatter stringFromDate:expiryDate];
+        NSString *containerId = [NSString stringWithFormat:@"%ld", (long)[container getId]];
+        NSDictionary *cachedInfo = containerInfoCache[containerId];
+        if (cachedInfo == nil) {
+            NSMutableDictionary *containerInfo = [NSMutableDictionary dictionary];
+            containerInfo[@"serverURL"] = [container getServerURL];
+            containerInfo[@"serverDomain"] = [container getProperty:HID_PROPERTY_DOMAIN error:&containerError];
+            containerInfo[@"serverVersion"] = [container getProperty:HID_PROPERTY_PROTOCOL_VERSION error:&containerError];
+            containerInfo[@"deviceId"] = [container getProperty:DEVICE_ID error:&containerError];
+            containerInfo[@"containerId"] = containerId;
+            containerInfo[@"containerUserId"] = [container getUserId];
+            containerInfo[@"containerFriendlyName"] = [container getName];
+            NSDate *creationDate = [container getCreationDate:&containerError];
+            NSDate *expiryDate = [container getExpiryDate:&containerError];
+            containerInfo[@"containerCreationDate"] = [formatter stringFromDate:creationDate];
+            containerInfo[@"containerExpirationDate"] = [formatter stringFromDate:expiryDate];
+            cachedInfo = containerInfo;
+            if (containerError != nil) {
+                NSLog(@"ApproveSDKWrapper ---> HID:getInfo error while reading container %@ info %@", containerId, [containerError localizedDescription]);
+                containerError = nil;
+            } else {
+                containerInfoCache[containerId] = cachedInfo;
+            }
+        }
+        NSMutableDictionary *containerInfo = [cachedInfo mutableCopy];
         containerInfo[@"isContainerRenewable"] = [container isRenewable:@"" error:&containerError] ? @"true" : @"false";
         
         [containerInfoArray addObject:containerInfo];
     }
+    @synchronized (self.infoFields) {
+        // Fields read before a create/renew/delete are not cached
+        if (generation == self.containerGeneration) {
+            self.containerInfoCache = containerInfoCache;
+            self.containerInfoGeneration = generation;
+        }
+    }
     
     getInfo[@"deviceInfo"] = deviceInfo;
     getInfo[@"containerInfo"] = containerInfoArray;
-    
-    NSError *error;
-    NSData *infoD = [NSJSONSerialization dataWithJSONObject:getInfo options:NSJSONWritingPrettyPrinted error:&error];
-    if (!infoD){
-        NSLog(@"ApproveSDKWrapper ---> HID:getInfo: JSON Error: %@", error.localizedDescription);
-        return nil;
-    }
-
-    NSString *info = [[NSString alloc] initWithData:infoD encoding:NSUTF8StringEncoding];
-    NSLog(@"ApproveSDKWrapper ---> HID:getInfo Get Info: %@", info);
-    
-    return info;
+    return getInfo;
 }
 
 /**
@@ -2551,6 +5353,99 @@
     return resultInfo;
 }
 
+/**
+* This method is used to get the OTP algorithm parameters of the OTP and signature keys of the container,
+* so that generated codes can be cross-checked against a reference HOTP/TOTP/OCRA implementation.
+*
+* @return NSString - A JSON string mapping each key label to its generator and algorithm parameters.
+*/
+-(NSString *)getOTPAlgorithmParameters{
+    NSMutableDictionary *result = [NSMutableDictionary dictionary];
+    NSError *error;
+    id<HIDContainer> pContainer = [self getSingleUserContainer];
+    if (pContainer == nil) {
+        NSLog(@"ApproveSDKWrapper ---> HID:getOTPAlgorithmParameters No Containers Found");
+        return nil;
+    }
+    NSMutableArray* filter = [[NSMutableArray alloc] init];
+    [filter addObject:[HIDParameter parameterWithString:HID_KEY_PROPERTY_USAGE_OTP forKey:HID_KEY_PROPERTY_USAGE]];
+    NSArray* keys = [pContainer findKeys:filter error:&error];
+    if(error != nil){
+        NSLog(@"ApproveSDKWrapper ---> HID:getOTPAlgorithmParameters Error while finding keys %@", [error localizedDescription]);
+    }
+    for(id<HIDKey> key in keys){
+        NSString *keyLabel = [key getProperty:HID_KEY_PROPERTY_LABEL error:nil];
+        id<HIDOTPGenerator> pOTPGenerator = [key getDefaultOTPGenerator:&error];
+        if(keyLabel == nil || pOTPGenerator == nil){
+            continue;
+        }
+        NSMutableDictionary *generatorInfo = [NSMutableDictionary dictionary];
+        generatorInfo[@"name"] = [pOTPGenerator getName];
+        generatorInfo[@"type"] = [pOTPGenerator getType];
+        generatorInfo[@"version"] = [pOTPGenerator getVersion];
+        NSObject<HIDAlgorithmParameters> *parameters = (NSObject<HIDAlgorithmParameters> *)[pOTPGenerator getAlgorithmParameters];
+        generatorInfo[@"standardVersion"] = [parameters getStandardVersion];
+        if([parameters conformsToProtocol:@protocol(HIDHOTPAlgorithmParameters)]){
+            id<HIDHOTPAlgorithmParameters> hotpParameters = (id<HIDHOTPAlgorithmParameters>)parameters;
+            generatorInfo[@"codeDigits"] = @([hotpParameters getCodeDigits]);
+            generatorInfo[@"checksum"] = @([hotpParameters isCheckSum]);
+            generatorInfo[@"truncationOffset"] = @([hotpParameters getTruncationOffset]);
+            generatorInfo[@"macAlgorithm"] = [hotpParameters getMACAlgo];
+            generatorInfo[@"counter"] = @([hotpParameters getCounter]);
+        }
+        if([parameters conformsToProtocol:@protocol(HIDTOTPAlgorithmParameters)]){
+            id<HIDTOTPAlgorithmParameters> totpParameters = (id<HIDTOTPAlgorithmParameters>)parameters;
+            generatorInfo[@"timeStep"] = @([totpParameters getTimeStep]);
+            generatorInfo[@"startTime"] = @([totpParameters getStartTime]);
+            generatorInfo[@"clock"] = @([totpParameters getClock]);
+        }
+        if([parameters conformsToProtocol:@protocol(HIDOCRAAlgorithmParameters)]){
+            id<HIDOCRAAlgorithmParameters> ocraParameters = (id<HIDOCRAAlgorithmParameters>)parameters;
+            generatorInfo[@"clientSuite"] = [self ocraSuiteInfo:[ocraParameters getClientOCRASuite]];
+            generatorInfo[@"serverSuite"] = [self ocraSuiteInfo:[ocraParameters getServerOCRASuite]];
+        }
+        result[keyLabel] = generatorInfo;
+    }
+
+    NSError *jsonError;
+    NSData *jsonData = [NSJSONSerialization dataWithJSONObject:result options:NSJSONWritingPrettyPrinted error:&jsonError];
+    if (!jsonData){
+        NSLog(@"ApproveSDKWrapper ---> HID:getOTPAlgorithmParameters: JSON Error: %@", jsonError.localizedDescription);
+        return nil;
+    }
+    NSString *resultInfo = [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
+    NSLog(@"ApproveSDKWrapper ---> HID:getOTPAlgorithmParameters Parameters: %@", resultInfo);
+    return resultInfo;
+}
+
+/**
+* This method describes an OCRA suite (RFC 6287) as a dictionary.
+*
+* @param suite - OCRA suite of the signature key.
+*
+* @return id - Dictionary of the suite fields, NSNull if the suite is not set.
+*/
+-(id)ocraSuiteInfo:(id<HIDOCRASuite>)suite{
+    if(suite == nil){
+        return [NSNull null];
+    }
+    NSMutableDictionary *suiteInfo = [NSMutableDictionary dictionary];
+    suiteInfo[@"suite"] = [suite toString];
+    suiteInfo[@"cryptoFunction"] = [suite getCryptoFunction];
+    suiteInfo[@"codeDigits"] = @([suite getCodeDigits]);
+    suiteInfo[@"hasCounter"] = @([suite hasCounter]);
+    suiteInfo[@"hasTime"] = @([suite hasTime]);
+    suiteInfo[@"timeStep"] = @([suite getTimeStep]);
+    suiteInfo[@"challengeFormat"] = [suite getChallengeFormat];
+    suiteInfo[@"minChallengeLength"] = @([suite getMinChallengeLength]);
+    suiteInfo[@"maxChallengeLength"] = @([suite getMaxChallengeLength]);
+    suiteInfo[@"pinRequired"] = @([suite isPinRequired]);
+    suiteInfo[@"pinHashAlgorithm"] = [suite getPINHashAlgo];
+    suiteInfo[@"sessionRequired"] = @([suite isSessionRequired]);
+    suiteInfo[@"sessionLength"] = @([suite getSessionLength]);
+    return suiteInfo;
+}
+
 /**
 * This public method performs a direct client signature operation using the
 * specified transaction message and key mode.
@@ -2560,74 +5455,42 @@
 * @param generateCallback - The callback function to execute after signing.
 */
 -(void)directClientSignature: (NSString *)txMessage withKeyMode:(NSString *)keyMode withGenerateCallback:(JSValue *)generateCallback {
-    
-    self.transactionMonitor = [[TransactionMonitor alloc] init];
-    
     dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
         NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature HID In directClientSignature");
         NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Transaction Message: %@", txMessage);
         NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Key Mode: %@", keyMode); //keyMode can be "pkp","pkip","skp".
         
-        NSString *keyLabel = @"";
         NSError *error;
         
         if (keyMode == nil || [keyMode length] == 0) {
             NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Key Mode is empty");
             [self executeGenericCallback:generateCallback withParams:@[@"Key Mode is null or empty"]];
             return;
-        }else{
-            if([keyMode.lowercaseString isEqualToString:PUSH_KEY_PUBLIC_LABEL_NAME]){
-                keyLabel = PUSH_KEY_PUBLIC_LABEL;
-                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Key Label set to %@", keyLabel);
-            }else if([keyMode.lowercaseString isEqualToString:PUSH_KEY_IDP_PUBLIC_LABEL_NAME]){
-                keyLabel = PUSH_KEY_IDP_PUBLIC_LABEL;
-                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Key Label set to %@", keyLabel);
-            }else if([keyMode.lowercaseString isEqualToString:SIGN_KEY_PUBLIC_LABEL_NAME]){
-                keyLabel = SIGN_KEY_PUBLIC_LABEL;
-                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Key Label set to %@", keyLabel);
-            }else{
-                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Invalid Key Mode: %@", keyMode);
-                [self executeGenericCallback:generateCallback withParams:@[@"Invalid Key Mode"]];
-                return;
-            }
         }
+        NSString *keyLabel = [self dcsKeyLabelsByMode][keyMode.lowercaseString];
+        if (keyLabel == nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Invalid Key Mode: %@", keyMode);
+            [self executeGenericCallback:generateCallback withParams:@[@"Invalid Key Mode"]];
+            return;
+        }
+        NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Key Label set to %@", keyLabel);
         
         id<HIDContainer> pContainer = [self getSingleUserContainer];
         
-        NSArray* keys = [pContainer findKeys:nil error:&error];
-        
         if (pContainer == nil) {
             NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature No Containers Found");
             [self executeGenericCallback:generateCallback withParams:@[@"No Container found"]];
             return;
         }
         
+        id<HIDKey> pKey = [self dcsKeyForContainer:pContainer withLabel:keyLabel error:&error];
         
-        if(keys.count == 0){
+        if(pKey == nil){
             NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature No Keys Found");
             [self executeGenericCallback:generateCallback withParams:@[@"No Keys found in the container"]];
             return;
         }
         
-        id<HIDKey> pKey = keys[0];
-        
-        if(keys.count > 1){
-            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature More than one key found, checking for label match");
-            for (id<HIDKey> key in keys) {
-                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature - Key: %@", key);
-                
-                NSString *keyCheck = [key getProperty:HID_KEY_PROPERTY_LABEL error:nil];
-                
-                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature - Key Label: %@", keyCheck);
-                
-                if(keyCheck != nil && [keyCheck caseInsensitiveCompare:keyLabel] == NSOrderedSame){
-                    pKey = key;
-                    NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature - Found Matched Key: %@", pKey);
-                    break;
-                }
-            }
-        }
-        
         NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Key Found: %@", pKey);
         
         NSString *keyId = [NSString stringWithFormat:@"%@",[pKey getId]];
@@ -2643,21 +5506,28 @@
             
             id<HIDTransaction> transaction = [pContainer generateAuthenticationRequest:txMessage withKey:[pKey getId] error:&error];
             
-            [self.transactionMonitor setTransaction:transaction];
+            // Only register requests that can be signed, errors are reported below
+            if (transaction == nil && error == nil) {
+                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature No transaction generated");
+                [self executeGenericCallback:generateCallback withParams:(@[@"error", @"Transaction could not be generated"])];
+            } else if (transaction != nil && error == nil) {
+                NSString *requestId = [self.transactionMonitor addTransaction:transaction timeout:DCS_TRANSACTION_TIMEOUT_SECONDS];
             
-            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Generated Transaction");
-            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Transaction ID: %@", [transaction getPayload:&error]);
+                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Generated Transaction");
+                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Transaction ID: %@", [transaction getPayload:&error]);
             
-            NSMutableDictionary *transactionInfo = [NSMutableDictionary dictionary];
-            transactionInfo[@"transaction"] = [NSString stringWithFormat:@"%@", transaction];
-            transactionInfo[@"transactionPayload"] = [transaction getPayload:&error];
-            transactionInfo[@"keyLabel"] = [pKey getProperty:HID_KEY_PROPERTY_LABEL error:&error];
-            transactionInfo[@"keyId"] = keyId;
+                NSMutableDictionary *transactionInfo = [NSMutableDictionary dictionary];
+                transactionInfo[@"transaction"] = [NSString stringWithFormat:@"%@", transaction];
+                transactionInfo[@"transactionPayload"] = [transaction getPayload:&error];
+                transactionInfo[@"keyLabel"] = [pKey getProperty:HID_KEY_PROPERTY_LABEL error:&error];
+                transactionInfo[@"keyId"] = keyId;
+                transactionInfo[@"dcsRequestId"] = requestId;
             
-            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Transaction generated successfully for key: %@ with Id: %@", keyMode, keyId);
-            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Transaction Info: %@", transactionInfo);
+                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Transaction generated successfully for key: %@ with Id: %@", keyMode, keyId);
+                NSLog(@"ApproveSDKWrapper ---> HID:directClientSignature Transaction Info: %@", transactionInfo);
             
-            [self executeGenericCallback:generateCallback withParams:@[@"success", transactionInfo]];
+                [self executeGenericCallback:generateCallback withParams:@[@"success", transactionInfo]];
+            }
             
             
         }
@@ -2682,8 +5552,74 @@
     });
 }
 
+/**
+* This method returns the table mapping a direct client signature key mode to its key label.
+*
+* @return NSDictionary - Key labels indexed by lowercase key mode ("pkp", "pkip", "skp").
+*/
+-(NSDictionary<NSString *, NSString *> *)dcsKeyLabelsByMode {
+    static NSDictionary<NSString *, NSString *> *keyLabelsByMode;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        keyLabelsByMode = @{
+            PUSH_KEY_PUBLIC_LABEL_NAME : PUSH_KEY_PUBLIC_LABEL,
+            PUSH_KEY_IDP_PUBLIC_LABEL_NAME : PUSH_KEY_IDP_PUBLIC_LABEL,
+            SIGN_KEY_PUBLIC_LABEL_NAME : SIGN_KEY_PUBLIC_LABEL
+        };
+    });
+    return keyLabelsByMode;
+}
+
+/**
+* This method returns the direct client signature key of the container with the given label.
+* The push and sign keys are resolved with a single findKeys call and kept until the container generation changes.
+*
+* @param pContainer - Container holding the keys.
+* @param keyLabel - The label of the key (PUSH_KEY_PUBLIC_LABEL, PUSH_KEY_IDP_PUBLIC_LABEL or SIGN_KEY_PUBLIC_LABEL).
+* @param error - Set when the keys could not be listed.
+*
+* @return id<HIDKey> - The matching key, the first key of the container if none matches, nil if it has no keys.
+*/
+-(id<HIDKey>)dcsKeyForContainer:(id<HIDContainer>)pContainer withLabel:(NSString *)keyLabel error:(NSError **)error {
+    [self syncContainerGeneration];
+    NSString *containerKey = [NSString stringWithFormat:@"%ld", (long)[pContainer getId]];
+    NSUInteger generation;
+    @synchronized (self.dcsKeyHandles) {
+        generation = self.containerGeneration;
+        id<HIDKey> cachedKey = self.dcsKeyHandles[[NSString stringWithFormat:@"%@|%@", containerKey, keyLabel.lowercaseString]];
+        if (cachedKey != nil) {
+            return cachedKey;
+        }
+    }
+    NSArray* keys = [pContainer findKeys:nil error:error];
+    if (keys.count == 0) {
+        return nil;
+    }
+    NSMutableDictionary<NSString *, id<HIDKey>> *resolvedKeys = [NSMutableDictionary dictionary];
+    NSArray *dcsLabels = [[self dcsKeyLabelsByMode] allValues];
+    for (id<HIDKey> key in keys) {
+        NSString *label = [[key getProperty:HID_KEY_PROPERTY_LABEL error:nil] lowercaseString];
+        for (NSString *dcsLabel in dcsLabels) {
+            if (label != nil && [label isEqualToString:dcsLabel.lowercaseString] && resolvedKeys[label] == nil) {
+                resolvedKeys[label] = key;
+            }
+        }
+    }
+    @synchronized (self.dcsKeyHandles) {
+        // Keys listed before a create/renew/delete are not cached
+        if (generation == self.containerGeneration) {
+            for (NSString *label in resolvedKeys) {
+                self.dcsKeyHandles[[NSString stringWithFormat:@"%@|%@", containerKey, label]] = resolvedKeys[label];
+            }
+        }
+    }
+    id<HIDKey> pKey = resolvedKeys[keyLabel.lowercaseString];
+    return pKey != nil ? pKey : keys[0];
+}
+
 /**
 * This public method is used to sign the request for the request generated in directClientSignature method.
+* The most recently generated request is signed; use the withRequestId variant when several requests are pending.
 *
 * @param consensus - status for the transaction (e.g., "approve").
 * @param password - password for the transaction, if required.
@@ -2694,49 +5630,141 @@
                            withPassword:(NSString *)password
                   withBiometricEnabled:(BOOL)isBiometricEnabled
                        withDCSCallback:(JSValue *)dcsCallback {
+    [self directClientSignatureWithStatus:consensus
+                            withRequestId:nil
+                             withPassword:password
+                     withBiometricEnabled:isBiometricEnabled
+                          withDCSCallback:dcsCallback];
+}
+
+/**
+* This public method is used to sign a request generated in directClientSignature method.
+*
+* @param consensus - status for the transaction (e.g., "approve").
+* @param requestId - dcsRequestId returned by directClientSignature, nil for the most recent request.
+* @param password - password for the transaction, if required.
+* @param isBiometricEnabled - boolean indicating if biometric authentication is enabled.
+* @param dcsCallback - The callback function to execute after signing with status.
+*/
+- (void)directClientSignatureWithStatus:(NSString *)consensus
+                          withRequestId:(NSString *)requestId
+                           withPassword:(NSString *)password
+                  withBiometricEnabled:(BOOL)isBiometricEnabled
+                       withDCSCallback:(JSValue *)dcsCallback {
 
-    if (self.transactionMonitor == nil) {
-        [self executeGenericCallback:dcsCallback withParams:@[@"MonitorNotInitialized", @"Transaction monitor not available"]];
+    PendingDCSTransaction *pendingTransaction = [self.transactionMonitor pendingTransactionForRequestId:requestId];
+    if (pendingTransaction == nil) {
+        [self executeGenericCallback:dcsCallback withParams:@[@"TransactionNotFound", @"No transaction available"]];
         return;
     }
 
-    // Set user input
-    [self.transactionMonitor setUserInputWithConsensus:consensus
-                                               password:password
-                                      biometricEnabled:isBiometricEnabled];
-
-    NSLog(@"ApproveSDKWrapper ---> HID:directClientSignatureWithStatus Consensus: %@, Password: %@, Biometric Enabled: %d",
-          consensus, password, isBiometricEnabled);
+    NSLog(@"ApproveSDKWrapper ---> HID:directClientSignatureWithStatus Request: %@, Consensus: %@, Biometric Enabled: %d",
+          pendingTransaction.requestId, consensus, isBiometricEnabled);
 
     dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
-        id<HIDTransaction> transaction = [self.transactionMonitor getTransaction];
-        id<HIDContainer> container = [self getSingleUserContainer];
+        id<HIDTransaction> transaction = pendingTransaction.transaction;
 
         if (!transaction) {
+            [self.transactionMonitor removeRequestId:pendingTransaction.requestId];
             [self executeGenericCallback:dcsCallback withParams:@[@"TransactionNotFound", @"No transaction available"]];
             return;
         }
 
         NSError *error = nil;
-        BOOL result = NO;
-
-        if (isBiometricEnabled) {
-            result = [transaction setStatus:consensus
-                       withSigningPassword:nil
-                       withSessionPassword:nil
-                               withParams:nil
-                                    error:&error];
+        BOOL result = [transaction setStatus:consensus
+                         withSigningPassword:(isBiometricEnabled ? nil : password)
+                         withSessionPassword:nil
+                                  withParams:nil
+                                       error:&error];
+
+        if (error) {
+            int errorCode = (int)[error code];
+            // Keep the request for another attempt when only the authentication failed
+            if (errorCode != 100 && errorCode != 101 && errorCode != 105 && errorCode != 203) {
+                [self.transactionMonitor removeRequestId:pendingTransaction.requestId];
+            }
+            [self handleSetStatusError:error callback:dcsCallback];
         } else {
-            result = [transaction setStatus:consensus
-                       withSigningPassword:password
-                       withSessionPassword:nil
-                               withParams:nil
-                                    error:&error];
+            [self.transactionMonitor removeRequestId:pendingTransaction.requestId];
+            [self sendTransactionStatusResult:transaction result:result dcsCallback:dcsCallback];
+        }
+    });
+}
+
+/**
+* This public method generates a direct client signature request and immediately sets its status in a single call,
+* for flows where the consensus is known upfront (e.g. silent or biometric approval).
+* The generated payload is sent to JS as an early event before the status is set.
+*
+* @param txMessage - The transaction message to be signed.
+* @param keyMode - The key mode: "pkp", "pkip" or "skp".
+* @param consensus - status for the transaction (e.g., "approve").
+* @param password - password for the transaction, if required.
+* @param isBiometricEnabled - boolean indicating if biometric authentication is enabled.
+* @param payloadCallback - The callback function receiving ("payload", transactionInfo) once the request is generated.
+* @param dcsCallback - The callback function to execute after signing with status, with the requestId and idToken.
+*/
+- (void)directClientSignatureWithConsensus:(NSString *)txMessage
+                               withKeyMode:(NSString *)keyMode
+                             withConsensus:(NSString *)consensus
+                              withPassword:(NSString *)password
+                     withBiometricEnabled:(BOOL)isBiometricEnabled
+                      withPayloadCallback:(JSValue *)payloadCallback
+                          withDCSCallback:(JSValue *)dcsCallback {
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError *error = nil;
+        NSString *keyLabel = [self dcsKeyLabelsByMode][keyMode.lowercaseString];
+        if (keyLabel == nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignatureWithConsensus Invalid Key Mode: %@", keyMode);
+            [self executeGenericCallback:dcsCallback withParams:@[@"Invalid Key Mode"]];
+            return;
+        }
+        if (txMessage == nil || [txMessage length] == 0) {
+            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignatureWithConsensus Transaction Message is empty");
+            [self executeGenericCallback:dcsCallback withParams:@[@"Transaction Message is empty"]];
+            return;
+        }
+        id<HIDContainer> pContainer = [self getSingleUserContainer];
+        if (pContainer == nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignatureWithConsensus No Containers Found");
+            [self executeGenericCallback:dcsCallback withParams:@[@"No Container found"]];
+            return;
+        }
+        id<HIDKey> pKey = [self dcsKeyForContainer:pContainer withLabel:keyLabel error:&error];
+        if (pKey == nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignatureWithConsensus No Keys Found");
+            [self executeGenericCallback:dcsCallback withParams:@[@"No Keys found in the container"]];
+            return;
+        }
+        id<HIDTransaction> transaction = [pContainer generateAuthenticationRequest:txMessage withKey:[pKey getId] error:&error];
+        if (error != nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignatureWithConsensus Error while generating request %@", [error localizedDescription]);
+            [self handleSetStatusError:error callback:dcsCallback];
+            return;
+        }
+        if (transaction == nil) {
+            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignatureWithConsensus No transaction generated");
+            [self executeGenericCallback:dcsCallback withParams:@[INTERNAL_EXCEPTION_NAME, @"Transaction could not be generated"]];
+            return;
+        }
+
+        NSMutableDictionary *transactionInfo = [NSMutableDictionary dictionary];
+        transactionInfo[@"transactionPayload"] = [transaction getPayload:nil];
+        transactionInfo[@"keyLabel"] = [pKey getProperty:HID_KEY_PROPERTY_LABEL error:nil];
+        transactionInfo[@"keyId"] = [NSString stringWithFormat:@"%@",[pKey getId]];
+        if (payloadCallback != nil) {
+            [self executeGenericCallback:payloadCallback withParams:@[@"payload", transactionInfo]];
         }
 
+        BOOL result = [transaction setStatus:consensus
+                         withSigningPassword:(isBiometricEnabled ? nil : password)
+                         withSessionPassword:nil
+                                  withParams:nil
+                                       error:&error];
         if (error) {
             [self handleSetStatusError:error callback:dcsCallback];
         } else {
+            NSLog(@"ApproveSDKWrapper ---> HID:directClientSignatureWithConsensus Status set for key: %@", keyMode);
             [self sendTransactionStatusResult:transaction result:result dcsCallback:dcsCallback];
         }
     });
@@ -2775,7 +5803,8 @@
 */
 - (void)handleSetStatusError:(NSError *)error callback:(JSValue *)callback {
     int errorCode = (int)[error code];
-    NSString *errorMessage = [error localizedDescription];
+    // A nil message would crash the array literals below
+    NSString *errorMessage = [error localizedDescription] != nil ? [error localizedDescription] : @"";
 
     NSLog(@"ApproveSDKWrapper ---> HID:invokePasswordAuthNotification Error While Updating the notification status %@", errorMessage);
 
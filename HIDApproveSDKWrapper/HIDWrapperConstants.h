@@ -14,6 +14,21 @@ extern NSString* const PWD_PROMPT_ERROR_EVENT_TYPE;
 extern NSString* const SIGN_TRANSACTION_FLOW;
 extern NSString* const SDK_ERROR_MSG_KEY;
 extern NSInteger const RENEW_EXPIRY_NOTIFICATION_DAYS;
+extern NSInteger const TRANSACTION_CACHE_CAPACITY;
+extern NSInteger const TRANSACTION_CACHE_DEFAULT_TTL_SECONDS;
+extern NSInteger const PENDING_TRANSACTION_FETCH_CONCURRENCY;
+extern NSInteger const NOTIFICATION_STATUS_BATCH_CONCURRENCY;
+extern NSInteger const SIGNATURE_CHALLENGE_CACHE_CAPACITY;
+extern NSInteger const SIGNATURE_CHALLENGE_CACHE_TTL_SECONDS;
+extern NSInteger const DCS_TRANSACTION_TIMEOUT_SECONDS;
+extern NSInteger const PUSH_ID_UPDATE_CONCURRENCY;
+extern NSString* const PUSH_ID_HASHES_DEFAULTS_KEY;
+extern NSString* const LOGIN_FLOW_SNAPSHOT_FILE_NAME;
+extern NSInteger const LOGIN_FLOW_SNAPSHOT_VERSION;
+extern NSInteger const PREWARM_WAIT_TIMEOUT_SECONDS;
+extern int const RENEWAL_DATE_ERROR;
+extern NSInteger const RENEWAL_CHECK_INTERVAL_SECONDS;
+extern NSInteger const RENEWAL_CHECK_LEEWAY_SECONDS;
 extern NSString* const PWD_EXPIRED_PROMPT_EVENT_CODE;
 extern NSString* const BIO_ALREADY_ENROLLED;
 extern NSString* const HID_GENERIC_EXCEPTION;
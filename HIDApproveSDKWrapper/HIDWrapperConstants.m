@@ -17,6 +17,21 @@ NSString *const PWD_PROMPT_ERROR_EVENT_CODE = @"5001";
 NSString *const PWD_EXPIRED_PROMPT_EVENT_CODE = @"5002";
 NSString *const SDK_ERROR_MSG_KEY = @"hid.error.msg";
 NSInteger const RENEW_EXPIRY_NOTIFICATION_DAYS = 20;
+NSInteger const TRANSACTION_CACHE_CAPACITY = 16;
+NSInteger const TRANSACTION_CACHE_DEFAULT_TTL_SECONDS = 300;
+NSInteger const PENDING_TRANSACTION_FETCH_CONCURRENCY = 4;
+NSInteger const NOTIFICATION_STATUS_BATCH_CONCURRENCY = 4;
+NSInteger const SIGNATURE_CHALLENGE_CACHE_CAPACITY = 8;
+NSInteger const SIGNATURE_CHALLENGE_CACHE_TTL_SECONDS = 600;
+NSInteger const DCS_TRANSACTION_TIMEOUT_SECONDS = 300;
+NSInteger const PUSH_ID_UPDATE_CONCURRENCY = 4;
+NSString *const PUSH_ID_HASHES_DEFAULTS_KEY = @"HIDApproveSDKWrapperPushIdHashes";
+NSString *const LOGIN_FLOW_SNAPSHOT_FILE_NAME = @"HIDLoginFlowSnapshot.plist";
+NSInteger const LOGIN_FLOW_SNAPSHOT_VERSION = 1;
+NSInteger const PREWARM_WAIT_TIMEOUT_SECONDS = 5;
+int const RENEWAL_DATE_ERROR = 1000000007;
+NSInteger const RENEWAL_CHECK_INTERVAL_SECONDS = 6 * 60 * 60;
+NSInteger const RENEWAL_CHECK_LEEWAY_SECONDS = 10 * 60;
 NSString *const BIO_ALREADY_ENROLLED = @"because it is enabled by another User in this Device";
 NSString *const HID_GENERIC_EXCEPTION = @"Exception";
 NSString *const HID_FINGERPRINT_EXCEPTION = @"FingerprintException";
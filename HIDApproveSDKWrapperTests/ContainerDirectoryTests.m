@@ -0,0 +1,166 @@
+//
+//  ContainerDirectoryTests.m
+//  HIDApproveSDKWrapperTests
+//
+
+#import <XCTest/XCTest.h>
+
+// Private to HIDApproveSDKWrapper.m
+@interface ContainerDirectoryEntry : NSObject
+@property (nonatomic, strong) id container;
+@property (nonatomic, copy) NSString *userId;
+@property (nonatomic, copy) NSString *friendlyName;
+@end
+
+@interface ContainerDirectory : NSObject
+@property (nonatomic, readonly) NSUInteger generation;
+@property (nonatomic, readonly) NSArray<ContainerDirectoryEntry *> *entries;
++ (NSString *)normalizedUserId:(NSString *)userId;
+- (instancetype)initWithContainers:(NSArray *)containers generation:(NSUInteger)generation;
+- (NSArray<ContainerDirectoryEntry *> *)entriesForUserId:(NSString *)userId;
+- (NSArray<ContainerDirectoryEntry *> *)sortedEntries;
+- (NSArray<ContainerDirectoryEntry *> *)entriesWithFriendlyNames;
+@end
+
+// Stands in for an HIDContainer, only the accessors read by ContainerDirectory
+@interface FakeContainer : NSObject
+@property (nonatomic, assign) NSInteger containerId;
+@property (nonatomic, copy) NSString *userId;
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, assign) NSUInteger nameReads;
+@end
+@implementation FakeContainer
+- (NSInteger)getId {
+    return self.containerId;
+}
+- (NSString *)getUserId {
+    return self.userId;
+}
+- (NSString *)getName {
+    self.nameReads++;
+    return self.name;
+}
+@end
+
+@interface ContainerDirectoryTests : XCTestCase
+@end
+
+@implementation ContainerDirectoryTests
+
+- (NSArray<FakeContainer *> *)containersWithUserIds:(NSArray<NSString *> *)userIds {
+    NSMutableArray *containers = [NSMutableArray array];
+    for (NSUInteger i = 0; i < [userIds count]; i++) {
+        FakeContainer *container = [[FakeContainer alloc] init];
+        container.containerId = (NSInteger)i + 1;
+        container.userId = userIds[i];
+        container.name = [NSString stringWithFormat:@"Container %lu", (unsigned long)i + 1];
+        [containers addObject:container];
+    }
+    return containers;
+}
+
+- (NSArray<FakeContainer *> *)containersForCount:(NSUInteger)count {
+    NSMutableArray *userIds = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [userIds addObject:[NSString stringWithFormat:@" user%04lu ", (unsigned long)((i * 7919) % count)]];
+    }
+    return [self containersWithUserIds:userIds];
+}
+
+- (void)testNormalizedLookup {
+    NSArray *containers = [self containersWithUserIds:@[@"alice", @" bob ", @"alice ", @"carol"]];
+    ContainerDirectory *directory = [[ContainerDirectory alloc] initWithContainers:containers generation:3];
+    XCTAssertEqual(directory.generation, 3u);
+    XCTAssertEqual([directory.entries count], 4u);
+
+    NSArray *aliceEntries = [directory entriesForUserId:@"  alice"];
+    XCTAssertEqual([aliceEntries count], 2u);
+    XCTAssertEqual([aliceEntries[0] container], containers[0]);
+    XCTAssertEqual([aliceEntries[1] container], containers[2]);
+    XCTAssertEqual([[directory entriesForUserId:@"bob"][0] container], containers[1]);
+    XCTAssertNil([directory entriesForUserId:@"dave"]);
+    XCTAssertNil([directory entriesForUserId:nil]);
+    XCTAssertEqualObjects([ContainerDirectory normalizedUserId:@"\t bob \t"], @"bob");
+}
+
+- (void)testSortedEntries {
+    NSArray *containers = [self containersWithUserIds:@[@"carol", @" alice", @"bob "]];
+    ContainerDirectory *directory = [[ContainerDirectory alloc] initWithContainers:containers generation:0];
+    NSArray *sortedEntries = [directory sortedEntries];
+    XCTAssertEqual([sortedEntries[0] container], containers[1]);
+    XCTAssertEqual([sortedEntries[1] container], containers[2]);
+    XCTAssertEqual([sortedEntries[2] container], containers[0]);
+    // SDK order is kept for the other accessors
+    XCTAssertEqual([directory.entries[0] container], containers[0]);
+    XCTAssertEqual([directory sortedEntries], sortedEntries);
+}
+
+- (void)testFriendlyNamesReadOnce {
+    NSArray<FakeContainer *> *containers = [self containersWithUserIds:@[@"alice", @"bob"]];
+    ContainerDirectory *directory = [[ContainerDirectory alloc] initWithContainers:containers generation:0];
+    XCTAssertEqual(containers[0].nameReads, 0u);
+    NSArray *entries = [directory entriesWithFriendlyNames];
+    [directory entriesWithFriendlyNames];
+    XCTAssertEqualObjects([entries[0] friendlyName], @"Container 1");
+    XCTAssertEqualObjects([entries[1] friendlyName], @"Container 2");
+    XCTAssertEqual(containers[0].nameReads, 1u);
+    XCTAssertEqual(containers[1].nameReads, 1u);
+}
+
+- (void)testLookupMatchesLinearScan {
+    NSArray<FakeContainer *> *containers = [self containersForCount:1000];
+    ContainerDirectory *directory = [[ContainerDirectory alloc] initWithContainers:containers generation:0];
+    for (NSUInteger i = 0; i < 1000; i += 37) {
+        NSString *userId = [NSString stringWithFormat:@"user%04lu", (unsigned long)i];
+        NSMutableArray *expected = [NSMutableArray array];
+        for (FakeContainer *container in containers) {
+            if ([[ContainerDirectory normalizedUserId:[container getUserId]] isEqualToString:userId]) {
+                [expected addObject:container];
+            }
+        }
+        XCTAssertEqualObjects([[directory entriesForUserId:userId] valueForKey:@"container"], expected);
+    }
+}
+
+- (void)measureLookupsWithCount:(NSUInteger)count useDirectory:(bool)useDirectory {
+    NSArray<FakeContainer *> *containers = [self containersForCount:count];
+    NSMutableArray *userIds = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [userIds addObject:[NSString stringWithFormat:@"user%04lu", (unsigned long)i]];
+    }
+    [self measureBlock:^{
+        // One directory per measurement, as it is rebuilt once per container generation
+        ContainerDirectory *directory = useDirectory ? [[ContainerDirectory alloc] initWithContainers:containers generation:0] : nil;
+        NSUInteger found = 0;
+        for (NSString *userId in userIds) {
+            if (useDirectory) {
+                found += [[directory entriesForUserId:userId] count];
+            } else {
+                for (FakeContainer *container in containers) {
+                    if ([[ContainerDirectory normalizedUserId:[container getUserId]] isEqualToString:userId]) {
+                        found++;
+                    }
+                }
+            }
+        }
+        XCTAssertEqual(found, count);
+    }];
+}
+
+- (void)testPerformanceDirectoryLookup10 {
+    [self measureLookupsWithCount:10 useDirectory:true];
+}
+
+- (void)testPerformanceLinearScan10 {
+    [self measureLookupsWithCount:10 useDirectory:false];
+}
+
+- (void)testPerformanceDirectoryLookup1000 {
+    [self measureLookupsWithCount:1000 useDirectory:true];
+}
+
+- (void)testPerformanceLinearScan1000 {
+    [self measureLookupsWithCount:1000 useDirectory:false];
+}
+
+@end
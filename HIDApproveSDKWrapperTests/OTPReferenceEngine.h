@@ -0,0 +1,14 @@
+//
+//  OTPReferenceEngine.h
+//  HIDApproveSDKWrapperTests
+//
+
+#import <Foundation/Foundation.h>
+
+//Reference HOTP (RFC 4226), TOTP (RFC 6238) and OCRA (RFC 6287) implementation to cross-check SDK output
+@interface OTPReferenceEngine : NSObject
++ (NSString *)hotpWithKey:(NSData *)key counter:(uint64_t)counter digits:(int)digits algorithm:(NSString *)algorithm;
++ (NSString *)totpWithKey:(NSData *)key time:(uint64_t)unixTime timeStep:(uint64_t)timeStep startTime:(uint64_t)startTime digits:(int)digits algorithm:(NSString *)algorithm;
++ (uint64_t)ocraTimeStepForSuite:(NSString *)suite time:(uint64_t)unixTime;
++ (NSString *)ocraWithSuite:(NSString *)suite key:(NSData *)key counter:(uint64_t)counter challenge:(NSString *)challenge pin:(NSString *)pin sessionInformation:(NSData *)sessionInformation timeStep:(uint64_t)timeStep;
+@end
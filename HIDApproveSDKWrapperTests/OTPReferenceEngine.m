@@ -0,0 +1,291 @@
+//
+//  OTPReferenceEngine.m
+//  HIDApproveSDKWrapperTests
+//
+
+#import "OTPReferenceEngine.h"
+#import <CommonCrypto/CommonDigest.h>
+#import <CommonCrypto/CommonHMAC.h>
+
+@implementation OTPReferenceEngine
+
+/**
+* This method computes an HOTP value (RFC 4226).
+*
+* @param key - The shared secret.
+* @param counter - The moving factor.
+* @param digits - Number of digits of the code, 1 to 10.
+* @param algorithm - HMAC hash, any name containing SHA1, SHA256 or SHA512 (e.g. the SDK MAC algorithm "HmacSHA1").
+*
+* @return NSString - The zero-padded code, nil if an argument is invalid.
+*/
++ (NSString *)hotpWithKey:(NSData *)key counter:(uint64_t)counter digits:(int)digits algorithm:(NSString *)algorithm {
+    NSMutableData *message = [NSMutableData dataWithCapacity:8];
+    [self appendUInt64:counter toData:message];
+    return [self codeWithKey:key message:message digits:digits algorithm:algorithm];
+}
+
+/**
+* This method computes a TOTP value (RFC 6238), i.e. the HOTP value of the number of time steps since startTime.
+*
+* @param key - The shared secret.
+* @param unixTime - Unix time in seconds.
+* @param timeStep - Time step in seconds.
+* @param startTime - Unix time in seconds at which counting starts (T0).
+* @param digits - Number of digits of the code, 1 to 10.
+* @param algorithm - HMAC hash, see hotpWithKey.
+*
+* @return NSString - The zero-padded code, nil if an argument is invalid.
+*/
++ (NSString *)totpWithKey:(NSData *)key time:(uint64_t)unixTime timeStep:(uint64_t)timeStep startTime:(uint64_t)startTime digits:(int)digits algorithm:(NSString *)algorithm {
+    if (timeStep == 0 || unixTime < startTime) {
+        return nil;
+    }
+    return [self hotpWithKey:key counter:(unixTime - startTime) / timeStep digits:digits algorithm:algorithm];
+}
+
+/**
+* This method returns the OCRA time step value for the time data input of the suite (T1M, T30S, T2H...).
+*
+* @param suite - The OCRA suite, e.g. "OCRA-1:HOTP-SHA512-8:QN08-T1M".
+* @param unixTime - Unix time in seconds.
+*
+* @return uint64_t - The number of time steps since the epoch, 0 if the suite has no time data input.
+*/
++ (uint64_t)ocraTimeStepForSuite:(NSString *)suite time:(uint64_t)unixTime {
+    NSArray<NSString *> *components = [[suite uppercaseString] componentsSeparatedByString:@":"];
+    if ([components count] != 3) {
+        return 0;
+    }
+    for (NSString *dataInput in [components[2] componentsSeparatedByString:@"-"]) {
+        NSUInteger length = [dataInput length];
+        if (length < 3 || [dataInput characterAtIndex:0] != 'T') {
+            continue;
+        }
+        uint64_t steps = (uint64_t)[[dataInput substringWithRange:NSMakeRange(1, length - 2)] longLongValue];
+        unichar unit = [dataInput characterAtIndex:(length - 1)];
+        uint64_t seconds = unit == 'S' ? 1 : (unit == 'M' ? 60 : (unit == 'H' ? 3600 : 0));
+        return steps * seconds > 0 ? unixTime / (steps * seconds) : 0;
+    }
+    return 0;
+}
+
+/**
+* This method computes an OCRA response (RFC 6287). The data inputs are taken in suite order: C, Q, P, S and T.
+*
+* @param suite - The OCRA suite as returned by HIDOCRASuite toString, e.g. "OCRA-1:HOTP-SHA256-8:C-QN08-PSHA1".
+* @param key - The shared secret.
+* @param counter - The counter, used when the suite has a C data input.
+* @param challenge - The challenge in the suite format: decimal digits (N), ASCII (A) or hex (H).
+* @param pin - The PIN, hashed with the suite's PIN hash when the suite has a P data input.
+* @param sessionInformation - The session information, used when the suite has an S data input.
+* @param timeStep - The time step value (see ocraTimeStepForSuite), used when the suite has a T data input.
+*
+* @return NSString - The zero-padded response, nil if the suite or an input is invalid.
+*/
++ (NSString *)ocraWithSuite:(NSString *)suite key:(NSData *)key counter:(uint64_t)counter challenge:(NSString *)challenge pin:(NSString *)pin sessionInformation:(NSData *)sessionInformation timeStep:(uint64_t)timeStep {
+    NSArray<NSString *> *components = [suite componentsSeparatedByString:@":"];
+    if ([components count] != 3) {
+        return nil;
+    }
+    NSArray<NSString *> *cryptoFunction = [[components[1] uppercaseString] componentsSeparatedByString:@"-"];
+    if ([cryptoFunction count] != 3 || ![cryptoFunction[0] isEqualToString:@"HOTP"]) {
+        return nil;
+    }
+    NSMutableData *message = [NSMutableData dataWithData:[suite dataUsingEncoding:NSUTF8StringEncoding]];
+    uint8_t separator = 0;
+    [message appendBytes:&separator length:1];
+    for (NSString *dataInput in [[components[2] uppercaseString] componentsSeparatedByString:@"-"]) {
+        unichar type = [dataInput length] > 0 ? [dataInput characterAtIndex:0] : 0;
+        if ([dataInput isEqualToString:@"C"]) {
+            [self appendUInt64:counter toData:message];
+        } else if (type == 'Q') {
+            NSData *question = [self ocraQuestion:challenge format:dataInput];
+            if (question == nil) {
+                return nil;
+            }
+            [message appendData:question];
+        } else if (type == 'P') {
+            NSData *pinHash = [self ocraPINHash:pin algorithm:[dataInput substringFromIndex:1]];
+            if (pinHash == nil) {
+                return nil;
+            }
+            [message appendData:pinHash];
+        } else if (type == 'S') {
+            // S064 (the default), S128, S256 or S512: left padded with zeros
+            NSUInteger length = [dataInput length] > 1 ? (NSUInteger)[[dataInput substringFromIndex:1] integerValue] : 64;
+            if (length == 0 || [sessionInformation length] > length) {
+                return nil;
+            }
+            [message appendData:[NSMutableData dataWithLength:(length - [sessionInformation length])]];
+            if (sessionInformation != nil) {
+                [message appendData:sessionInformation];
+            }
+        } else if (type == 'T') {
+            [self appendUInt64:timeStep toData:message];
+        } else {
+            return nil;
+        }
+    }
+    return [self codeWithKey:key message:message digits:[cryptoFunction[2] intValue] algorithm:cryptoFunction[1]];
+}
+
+/**
+* This private method encodes the challenge into the 128 byte OCRA question block.
+* Numeric challenges are converted to hexadecimal; numeric and hex challenges are padded on the right by nibble.
+*/
++ (NSData *)ocraQuestion:(NSString *)challenge format:(NSString *)dataInput {
+    // Q<format><maximum length 04-64>
+    if ([dataInput length] != 4 || challenge == nil) {
+        return nil;
+    }
+    unichar format = [dataInput characterAtIndex:1];
+    if ([challenge length] > (NSUInteger)[[dataInput substringFromIndex:2] integerValue]) {
+        return nil;
+    }
+    NSMutableData *question = nil;
+    if (format == 'N') {
+        question = [self dataFromHex:[self hexFromDecimal:challenge]];
+    } else if (format == 'H') {
+        question = [self dataFromHex:challenge];
+    } else if (format == 'A') {
+        question = [[challenge dataUsingEncoding:NSASCIIStringEncoding] mutableCopy];
+    }
+    if (question == nil || [question length] > 128) {
+        return nil;
+    }
+    [question setLength:128];
+    return question;
+}
+
+/**
+* This private method hashes the PIN with the P data input hash: SHA1, SHA256 or SHA512.
+*/
++ (NSData *)ocraPINHash:(NSString *)pin algorithm:(NSString *)algorithm {
+    NSData *pinData = [pin dataUsingEncoding:NSUTF8StringEncoding];
+    if (pinData == nil) {
+        return nil;
+    }
+    NSMutableData *pinHash = nil;
+    if ([algorithm isEqualToString:@"SHA1"]) {
+        pinHash = [NSMutableData dataWithLength:CC_SHA1_DIGEST_LENGTH];
+        CC_SHA1([pinData bytes], (CC_LONG)[pinData length], [pinHash mutableBytes]);
+    } else if ([algorithm isEqualToString:@"SHA256"]) {
+        pinHash = [NSMutableData dataWithLength:CC_SHA256_DIGEST_LENGTH];
+        CC_SHA256([pinData bytes], (CC_LONG)[pinData length], [pinHash mutableBytes]);
+    } else if ([algorithm isEqualToString:@"SHA512"]) {
+        pinHash = [NSMutableData dataWithLength:CC_SHA512_DIGEST_LENGTH];
+        CC_SHA512([pinData bytes], (CC_LONG)[pinData length], [pinHash mutableBytes]);
+    }
+    return pinHash;
+}
+
+/**
+* This private method computes the HMAC of the message and applies the dynamic truncation of RFC 4226.
+*/
++ (NSString *)codeWithKey:(NSData *)key message:(NSData *)message digits:(int)digits algorithm:(NSString *)algorithm {
+    NSString *hash = [algorithm uppercaseString];
+    CCHmacAlgorithm hmacAlgorithm;
+    size_t hashLength;
+    if ([hash rangeOfString:@"SHA512"].location != NSNotFound) {
+        hmacAlgorithm = kCCHmacAlgSHA512;
+        hashLength = CC_SHA512_DIGEST_LENGTH;
+    } else if ([hash rangeOfString:@"SHA256"].location != NSNotFound) {
+        hmacAlgorithm = kCCHmacAlgSHA256;
+        hashLength = CC_SHA256_DIGEST_LENGTH;
+    } else if ([hash rangeOfString:@"SHA1"].location != NSNotFound) {
+        hmacAlgorithm = kCCHmacAlgSHA1;
+        hashLength = CC_SHA1_DIGEST_LENGTH;
+    } else {
+        return nil;
+    }
+    if (key == nil || digits < 1 || digits > 10) {
+        return nil;
+    }
+    uint8_t mac[CC_SHA512_DIGEST_LENGTH];
+    CCHmac(hmacAlgorithm, [key bytes], [key length], [message bytes], [message length], mac);
+    int offset = mac[hashLength - 1] & 0x0f;
+    uint64_t binary = ((uint64_t)(mac[offset] & 0x7f) << 24) | ((uint64_t)mac[offset + 1] << 16) | ((uint64_t)mac[offset + 2] << 8) | (uint64_t)mac[offset + 3];
+    uint64_t modulus = 1;
+    for (int i = 0; i < digits; i++) {
+        modulus *= 10;
+    }
+    return [NSString stringWithFormat:@"%0*llu", digits, (unsigned long long)(binary % modulus)];
+}
+
++ (void)appendUInt64:(uint64_t)value toData:(NSMutableData *)data {
+    uint8_t bytes[8];
+    for (int i = 0; i < 8; i++) {
+        bytes[7 - i] = (uint8_t)(value >> (8 * i));
+    }
+    [data appendBytes:bytes length:8];
+}
+
+/**
+* This private method converts a decimal string of any length to hexadecimal by repeated division by 16.
+*/
++ (NSString *)hexFromDecimal:(NSString *)decimal {
+    NSUInteger length = [decimal length];
+    if (length == 0) {
+        return nil;
+    }
+    NSMutableData *digitData = [NSMutableData dataWithLength:length];
+    uint8_t *digits = [digitData mutableBytes];
+    for (NSUInteger i = 0; i < length; i++) {
+        unichar c = [decimal characterAtIndex:i];
+        if (c < '0' || c > '9') {
+            return nil;
+        }
+        digits[i] = (uint8_t)(c - '0');
+    }
+    NSMutableString *hex = [NSMutableString string];
+    NSUInteger start = 0;
+    do {
+        unsigned int remainder = 0;
+        for (NSUInteger i = start; i < length; i++) {
+            unsigned int value = remainder * 10 + digits[i];
+            digits[i] = (uint8_t)(value / 16);
+            remainder = value % 16;
+        }
+        [hex insertString:[NSString stringWithFormat:@"%X", remainder] atIndex:0];
+        while (start < length && digits[start] == 0) {
+            start++;
+        }
+    } while (start < length);
+    return hex;
+}
+
+/**
+* This private method decodes a hex string, padding an odd number of digits with a trailing zero nibble.
+*/
++ (NSMutableData *)dataFromHex:(NSString *)hex {
+    if (hex == nil) {
+        return nil;
+    }
+    NSString *paddedHex = [hex length] % 2 == 0 ? hex : [hex stringByAppendingString:@"0"];
+    NSMutableData *data = [NSMutableData dataWithCapacity:([paddedHex length] / 2)];
+    for (NSUInteger i = 0; i < [paddedHex length]; i += 2) {
+        int high = [self hexDigitValue:[paddedHex characterAtIndex:i]];
+        int low = [self hexDigitValue:[paddedHex characterAtIndex:(i + 1)]];
+        if (high < 0 || low < 0) {
+            return nil;
+        }
+        uint8_t byte = (uint8_t)((high << 4) | low);
+        [data appendBytes:&byte length:1];
+    }
+    return data;
+}
+
++ (int)hexDigitValue:(unichar)c {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+@end
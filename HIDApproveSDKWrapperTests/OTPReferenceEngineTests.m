@@ -0,0 +1,111 @@
+//
+//  OTPReferenceEngineTests.m
+//  HIDApproveSDKWrapperTests
+//
+
+#import <XCTest/XCTest.h>
+#import "OTPReferenceEngine.h"
+
+@interface OTPReferenceEngineTests : XCTestCase
+@property (nonatomic, strong) NSData *key20;
+@property (nonatomic, strong) NSData *key32;
+@property (nonatomic, strong) NSData *key64;
+@end
+
+@implementation OTPReferenceEngineTests
+
+- (void)setUp {
+    // Test keys of RFC 6238 Appendix B and RFC 6287 Appendix C
+    self.key20 = [@"12345678901234567890" dataUsingEncoding:NSUTF8StringEncoding];
+    self.key32 = [@"12345678901234567890123456789012" dataUsingEncoding:NSUTF8StringEncoding];
+    self.key64 = [@"1234567890123456789012345678901234567890123456789012345678901234" dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+// RFC 4226 Appendix D
+- (void)testHOTP {
+    NSArray *expected = @[@"755224", @"287082", @"359152", @"969429", @"338314",
+                          @"254676", @"287922", @"162583", @"399871", @"520489"];
+    for (NSUInteger counter = 0; counter < [expected count]; counter++) {
+        XCTAssertEqualObjects([OTPReferenceEngine hotpWithKey:self.key20 counter:counter digits:6 algorithm:@"HmacSHA1"], expected[counter]);
+    }
+}
+
+// RFC 6238 Appendix B
+- (void)testTOTP {
+    NSArray *times = @[@59, @1111111109, @1111111111, @1234567890, @2000000000, @20000000000];
+    NSArray *sha1 = @[@"94287082", @"07081804", @"14050471", @"89005924", @"69279037", @"65353130"];
+    NSArray *sha256 = @[@"46119246", @"68084774", @"67062674", @"91819424", @"90698825", @"77737706"];
+    NSArray *sha512 = @[@"90693936", @"25091201", @"99943326", @"93441116", @"38618901", @"47863826"];
+    for (NSUInteger i = 0; i < [times count]; i++) {
+        uint64_t time = [times[i] unsignedLongLongValue];
+        XCTAssertEqualObjects([OTPReferenceEngine totpWithKey:self.key20 time:time timeStep:30 startTime:0 digits:8 algorithm:@"SHA1"], sha1[i]);
+        XCTAssertEqualObjects([OTPReferenceEngine totpWithKey:self.key32 time:time timeStep:30 startTime:0 digits:8 algorithm:@"SHA256"], sha256[i]);
+        XCTAssertEqualObjects([OTPReferenceEngine totpWithKey:self.key64 time:time timeStep:30 startTime:0 digits:8 algorithm:@"SHA512"], sha512[i]);
+    }
+}
+
+- (void)testInvalidArguments {
+    XCTAssertNil([OTPReferenceEngine hotpWithKey:self.key20 counter:0 digits:6 algorithm:@"MD5"]);
+    XCTAssertNil([OTPReferenceEngine hotpWithKey:self.key20 counter:0 digits:11 algorithm:@"SHA1"]);
+    XCTAssertNil([OTPReferenceEngine hotpWithKey:nil counter:0 digits:6 algorithm:@"SHA1"]);
+    XCTAssertNil([OTPReferenceEngine totpWithKey:self.key20 time:59 timeStep:0 startTime:0 digits:8 algorithm:@"SHA1"]);
+    XCTAssertNil([OTPReferenceEngine totpWithKey:self.key20 time:59 timeStep:30 startTime:60 digits:8 algorithm:@"SHA1"]);
+    XCTAssertNil([OTPReferenceEngine ocraWithSuite:@"OCRA-1:HOTP-SHA1-6:QN08" key:self.key20 counter:0 challenge:@"123456789" pin:nil sessionInformation:nil timeStep:0]);
+    XCTAssertNil([OTPReferenceEngine ocraWithSuite:@"OCRA-1:HOTP-SHA1-6:QN08" key:self.key20 counter:0 challenge:@"1234ABCD" pin:nil sessionInformation:nil timeStep:0]);
+    XCTAssertNil([OTPReferenceEngine ocraWithSuite:@"OCRA-1:HOTP-SHA1-6:QN08-PSHA1" key:self.key20 counter:0 challenge:@"12345678" pin:nil sessionInformation:nil timeStep:0]);
+    XCTAssertNil([OTPReferenceEngine ocraWithSuite:@"OCRA-1:HOTP-SHA1-6" key:self.key20 counter:0 challenge:@"12345678" pin:nil sessionInformation:nil timeStep:0]);
+}
+
+// RFC 6287 Appendix C, one-way challenge-response
+- (void)testOCRAOneWay {
+    NSArray *expected = @[@"237653", @"243178", @"653583", @"740991", @"608993",
+                          @"388898", @"816933", @"224598", @"750600", @"294470"];
+    for (int i = 0; i < 10; i++) {
+        NSString *challenge = [@"" stringByPaddingToLength:8 withString:[NSString stringWithFormat:@"%d", i] startingAtIndex:0];
+        XCTAssertEqualObjects([OTPReferenceEngine ocraWithSuite:@"OCRA-1:HOTP-SHA1-6:QN08" key:self.key20 counter:0 challenge:challenge pin:nil sessionInformation:nil timeStep:0], expected[i]);
+    }
+
+    expected = @[@"65347737", @"86775851", @"78192410", @"71565254", @"10104329",
+                 @"65983500", @"70069104", @"91771096", @"75011558", @"08522129"];
+    for (int counter = 0; counter < 10; counter++) {
+        XCTAssertEqualObjects([OTPReferenceEngine ocraWithSuite:@"OCRA-1:HOTP-SHA256-8:C-QN08-PSHA1" key:self.key32 counter:counter challenge:@"12345678" pin:@"1234" sessionInformation:nil timeStep:0], expected[counter]);
+    }
+
+    expected = @[@"83238735", @"01501458", @"17957585", @"86776967", @"86807031"];
+    for (int i = 0; i < 5; i++) {
+        NSString *challenge = [@"" stringByPaddingToLength:8 withString:[NSString stringWithFormat:@"%d", i] startingAtIndex:0];
+        XCTAssertEqualObjects([OTPReferenceEngine ocraWithSuite:@"OCRA-1:HOTP-SHA256-8:QN08-PSHA1" key:self.key32 counter:0 challenge:challenge pin:@"1234" sessionInformation:nil timeStep:0], expected[i]);
+    }
+
+    expected = @[@"07016083", @"63947962", @"70123924", @"25341727", @"33203315",
+                 @"34205738", @"44343969", @"51946085", @"20403879", @"31409299"];
+    for (int i = 0; i < 10; i++) {
+        NSString *challenge = [@"" stringByPaddingToLength:8 withString:[NSString stringWithFormat:@"%d", i] startingAtIndex:0];
+        XCTAssertEqualObjects([OTPReferenceEngine ocraWithSuite:@"OCRA-1:HOTP-SHA512-8:C-QN08" key:self.key64 counter:i challenge:challenge pin:nil sessionInformation:nil timeStep:0], expected[i]);
+    }
+}
+
+// RFC 6287 Appendix C, time-based one-way challenge-response (T = 132d0b6 at 25 Mar 2008 12:06:30 GMT)
+- (void)testOCRATimeBased {
+    NSString *suite = @"OCRA-1:HOTP-SHA512-8:QN08-T1M";
+    uint64_t timeStep = [OTPReferenceEngine ocraTimeStepForSuite:suite time:1206446790];
+    XCTAssertEqual(timeStep, 0x132d0b6ULL);
+    XCTAssertEqual([OTPReferenceEngine ocraTimeStepForSuite:@"OCRA-1:HOTP-SHA1-6:QN08" time:1206446790], 0ULL);
+
+    NSArray *expected = @[@"95209754", @"55907591", @"22048402", @"24218844", @"36209546"];
+    for (int i = 0; i < 5; i++) {
+        NSString *challenge = [@"" stringByPaddingToLength:8 withString:[NSString stringWithFormat:@"%d", i] startingAtIndex:0];
+        XCTAssertEqualObjects([OTPReferenceEngine ocraWithSuite:suite key:self.key64 counter:0 challenge:challenge pin:nil sessionInformation:nil timeStep:timeStep], expected[i]);
+    }
+}
+
+- (void)testPerformanceBulkVerification {
+    [self measureBlock:^{
+        for (uint64_t counter = 0; counter < 10000; counter++) {
+            [OTPReferenceEngine hotpWithKey:self.key20 counter:counter digits:6 algorithm:@"SHA1"];
+            [OTPReferenceEngine ocraWithSuite:@"OCRA-1:HOTP-SHA256-8:C-QN08-PSHA1" key:self.key32 counter:counter challenge:@"12345678" pin:@"1234" sessionInformation:nil timeStep:0];
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,133 @@
+//
+//  RenewalScheduleTests.m
+//  HIDApproveSDKWrapperTests
+//
+
+#import <XCTest/XCTest.h>
+
+// Private to HIDApproveSDKWrapper.m
+@interface RenewalSchedule : NSObject
+@property (nonatomic, readonly) int64_t creationMillis;
+@property (nonatomic, readonly) int64_t expiryMillis;
+@property (nonatomic, readonly) NSDate *renewalDate;
+@property (nonatomic, readonly) int totalDays;
+@property (nonatomic, readonly) int thresholdDays;
+- (instancetype)initWithCreationDate:(NSDate *)creationDate expiryDate:(NSDate *)expiryDate renewalDate:(NSDate *)renewalDate;
++ (int64_t)currentMillis;
++ (NSInteger)daysFrom:(NSDate *)startDate to:(NSDate *)endDate;
+- (int)daysToExpiryAt:(int64_t)nowMillis;
+- (int)finalDaysAt:(int64_t)nowMillis;
+@end
+
+// calFinalDays as it was before the threshold was precomputed
+static int LegacyFinalDays(int total, int end) {
+    float perc = ((float)end / (float)total) * 100;
+    if (end <= 2 || perc < 20.0f) return end;
+    return (-1 * end);
+}
+
+@interface RenewalScheduleTests : XCTestCase
+@end
+
+@implementation RenewalScheduleTests
+
+- (RenewalSchedule *)scheduleWithTotalDays:(int)totalDays {
+    NSDate *creationDate = [NSDate dateWithTimeIntervalSince1970:1700000000];
+    NSDate *expiryDate = [creationDate dateByAddingTimeInterval:(totalDays * 86400.0)];
+    return [[RenewalSchedule alloc] initWithCreationDate:creationDate expiryDate:expiryDate renewalDate:nil];
+}
+
+- (void)testThresholds {
+    XCTAssertEqual([self scheduleWithTotalDays:0].thresholdDays, 2);
+    XCTAssertEqual([self scheduleWithTotalDays:10].thresholdDays, 2);
+    XCTAssertEqual([self scheduleWithTotalDays:100].thresholdDays, 19);
+    XCTAssertEqual([self scheduleWithTotalDays:101].thresholdDays, 20);
+    XCTAssertEqual([self scheduleWithTotalDays:365].thresholdDays, 72);
+
+    RenewalSchedule *schedule = [self scheduleWithTotalDays:365];
+    XCTAssertEqual(schedule.totalDays, 365);
+    XCTAssertEqual([schedule finalDaysAt:(schedule.expiryMillis - 72 * 86400000LL)], 72);
+    XCTAssertEqual([schedule finalDaysAt:(schedule.expiryMillis - 73 * 86400000LL)], -73);
+    // Partial days are dropped, past the expiry the distance counts
+    XCTAssertEqual([schedule daysToExpiryAt:(schedule.expiryMillis - 86399999LL)], 0);
+    XCTAssertEqual([schedule daysToExpiryAt:(schedule.expiryMillis + 3 * 86400000LL)], 3);
+}
+
+- (void)testFinalDaysMatchLegacyFormula {
+    for (int total = 0; total <= 3000; total++) {
+        RenewalSchedule *schedule = [self scheduleWithTotalDays:total];
+        for (int end = 0; end <= 3000; end++) {
+            int finalDays = [schedule finalDaysAt:(schedule.expiryMillis - end * 86400000LL)];
+            if (finalDays != LegacyFinalDays(total, end)) {
+                XCTFail(@"total %d end %d: %d, expected %d", total, end, finalDays, LegacyFinalDays(total, end));
+                return;
+            }
+        }
+    }
+}
+
+- (void)testDaysFromMatchesCalendar {
+    NSCalendar *calendar = [[NSCalendar alloc] initWithCalendarIdentifier:NSCalendarIdentifierGregorian];
+    calendar.timeZone = [NSTimeZone timeZoneForSecondsFromGMT:0];
+    NSDate *startDate = [NSDate dateWithTimeIntervalSince1970:1700000000];
+    NSArray *offsets = @[@0, @1, @43200, @86399];
+    for (int days = -40; days <= 40; days++) {
+        for (NSNumber *offset in offsets) {
+            NSTimeInterval interval = days * 86400.0 + (days < 0 ? -1 : 1) * [offset doubleValue];
+            NSDate *endDate = [startDate dateByAddingTimeInterval:interval];
+            NSInteger expected = [[calendar components:NSCalendarUnitDay fromDate:startDate toDate:endDate options:0] day];
+            XCTAssertEqual([RenewalSchedule daysFrom:startDate to:endDate], expected, @"interval %f", interval);
+        }
+    }
+}
+
+- (void)testPerformanceFinalDays {
+    RenewalSchedule *schedule = [self scheduleWithTotalDays:365];
+    int64_t now = [RenewalSchedule currentMillis];
+    [self measureBlock:^{
+        for (int i = 0; i < 1000000; i++) {
+            [schedule finalDaysAt:(now + i)];
+        }
+    }];
+}
+
+- (void)testPerformanceLegacyFinalDays {
+    NSDate *creationDate = [NSDate dateWithTimeIntervalSince1970:1700000000];
+    NSDate *expiryDate = [creationDate dateByAddingTimeInterval:(365 * 86400.0)];
+    [self measureBlock:^{
+        int checksum = 0;
+        for (int i = 0; i < 1000000; i++) {
+            // Dates re-read and converted on every call, as before
+            NSTimeInterval containerExpiry = [expiryDate timeIntervalSince1970];
+            NSTimeInterval containerStart = [creationDate timeIntervalSince1970];
+            long currentMilli = (long)([[NSDate date] timeIntervalSince1970] * 1000);
+            int endDays = (int)(labs((long)(containerExpiry * 1000) - currentMilli) / 86400000);
+            int totalDays = (int)((long)(fabs(containerExpiry - containerStart) * 1000) / 86400000);
+            checksum += LegacyFinalDays(totalDays, endDays);
+        }
+        XCTAssertNotEqual(checksum, 0);
+    }];
+}
+
+- (void)testPerformanceDaysFrom {
+    NSDate *startDate = [NSDate date];
+    NSDate *endDate = [startDate dateByAddingTimeInterval:(30 * 86400.0)];
+    [self measureBlock:^{
+        for (int i = 0; i < 100000; i++) {
+            [RenewalSchedule daysFrom:startDate to:endDate];
+        }
+    }];
+}
+
+- (void)testPerformanceCalendarDays {
+    NSDate *startDate = [NSDate date];
+    NSDate *endDate = [startDate dateByAddingTimeInterval:(30 * 86400.0)];
+    [self measureBlock:^{
+        for (int i = 0; i < 100000; i++) {
+            NSCalendar *calendar = [[NSCalendar alloc] initWithCalendarIdentifier:NSCalendarIdentifierGregorian];
+            [[calendar components:NSCalendarUnitDay fromDate:startDate toDate:endDate options:0] day];
+        }
+    }];
+}
+
+@end
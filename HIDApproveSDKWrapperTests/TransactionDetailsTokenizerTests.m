@@ -0,0 +1,70 @@
+//
+//  TransactionDetailsTokenizerTests.m
+//  HIDApproveSDKWrapperTests
+//
+
+#import <XCTest/XCTest.h>
+#import <JavaScriptCore/JavaScriptCore.h>
+
+// Private to HIDApproveSDKWrapper.m
+@interface TransactionDetailsTokenizer : NSObject
++ (NSArray<NSString *> *)fieldsFromString:(NSString *)details separator:(unichar)separator;
+@end
+
+@interface TransactionDetailsTokenizerTests : XCTestCase
+@property (nonatomic, strong) NSString *largeSignDetails;
+@end
+
+@implementation TransactionDetailsTokenizerTests
+
+- (void)setUp {
+    NSMutableArray *fields = [NSMutableArray array];
+    for (int i = 0; i < 2000; i++) {
+        [fields addObject:[NSString stringWithFormat:@"Payee %d, amount %d.%02d EUR", i, i * 7, i % 100]];
+    }
+    self.largeSignDetails = [fields componentsJoinedByString:@"~"];
+}
+
+- (void)testFieldsMatchComponentsSeparatedByString {
+    NSArray *inputs = @[@"", @"~", @"~~", @"a", @"a~b~c", @"~a~", @"a~~b", @"Amount~1000~Payee~ACME", @"été~\U0001F600~x"];
+    for (NSString *input in inputs) {
+        XCTAssertEqualObjects([TransactionDetailsTokenizer fieldsFromString:input separator:'~'],
+                              [input componentsSeparatedByString:@"~"], @"input %@", input);
+    }
+    XCTAssertEqualObjects([TransactionDetailsTokenizer fieldsFromString:self.largeSignDetails separator:'~'],
+                          [self.largeSignDetails componentsSeparatedByString:@"~"]);
+}
+
+- (void)testFieldsFromNilString {
+    XCTAssertNil([TransactionDetailsTokenizer fieldsFromString:nil separator:'~']);
+}
+
+- (void)testPerformanceTokenizer {
+    [self measureBlock:^{
+        for (int i = 0; i < 20; i++) {
+            [TransactionDetailsTokenizer fieldsFromString:self.largeSignDetails separator:'~'];
+        }
+    }];
+}
+
+- (void)testPerformanceComponentsSeparatedByString {
+    [self measureBlock:^{
+        for (int i = 0; i < 20; i++) {
+            [self.largeSignDetails componentsSeparatedByString:@"~"];
+        }
+    }];
+}
+
+- (void)testPerformanceJavaScriptParsing {
+    JSContext *context = [[JSContext alloc] init];
+    [context evaluateScript:@"function parse(details) { return details.split('~'); }"];
+    JSValue *parse = context[@"parse"];
+    [self measureBlock:^{
+        for (int i = 0; i < 20; i++) {
+            // Includes crossing the bridge both ways, as the JS screens do today
+            [[parse callWithArguments:@[self.largeSignDetails]] toArray];
+        }
+    }];
+}
+
+@end